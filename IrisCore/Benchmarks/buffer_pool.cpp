@@ -0,0 +1,104 @@
+/**
+ * @file buffer_pool.cpp
+ * @author Ryan Landvater
+ * @brief Iris buffer pool versus malloc tile churn benchmark
+ * @version 2024.0.1
+ * @date 2024-11-04
+ *
+ * @copyright Copyright (c) 2023-24
+ *
+ * Simulates decoded tile churn while panning: N threads each keep a
+ * window of live 256x256 RGBA tiles (256 KiB) and continuously replace the
+ * oldest tile with a newly created and written one. The workload runs once
+ * on pooled Iris strong buffers and once on plain malloc / free, and the
+ * pool's hit and miss counters are reported so the pool can be sized.
+ *
+ */
+
+// Include standard headers
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <thread>
+#include <chrono>
+#include <iostream>
+
+// Include Iris Core header
+#include "IrisCore.hpp"
+
+// Workload parameters
+#define             TILE_BYTES      (256 * 256 * 4)
+#define             LIVE_TILES      32
+#define             TILES_PER_THREAD 20000
+
+// Run the churn workload on the given number of threads and return seconds elapsed
+template <class __Create, class __Release>
+static double churn (unsigned threads, __Create create, __Release release)
+{
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> workers;
+    for (unsigned t = 0; t < threads; ++t)
+        workers.emplace_back([&] {
+            std::vector<decltype(create())> window (LIVE_TILES);
+            for (unsigned i = 0; i < TILES_PER_THREAD; ++i) {
+                auto& slot = window[i % LIVE_TILES];
+                release(slot);
+                slot = create();
+            }
+            for (auto& slot : window) release(slot);
+        });
+    for (auto& worker : workers) worker.join();
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+int main (int argc, char** argv)
+{
+    // Usage: buffer_pool [threads]
+    unsigned threads = argc > 1 ? static_cast<unsigned>(atoi(argv[1])) :
+                       std::max(1u, std::thread::hardware_concurrency());
+    double   tiles   = double(threads) * TILES_PER_THREAD;
+    std::cout << threads << " thread(s), " << LIVE_TILES << " live tiles per thread\n";
+
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ //
+    //        Pooled Iris strong buffers        //
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ //
+    // Each tile is fully written, as a decoder would, so that
+    // the cost of faulting in fresh pages is included.
+    Iris::BufferPoolStatistics before = Iris::Buffer_pool_get_statistics();
+    double pooled = churn(threads,
+        [] {
+            Iris::Buffer tile = Iris::Create_strong_buffer(TILE_BYTES);
+            memset(Iris::Buffer_write_into_buffer(tile, TILE_BYTES), 0xFF, TILE_BYTES);
+            return tile;
+        },
+        [] (Iris::Buffer& tile) { tile.reset(); });
+    Iris::BufferPoolStatistics after = Iris::Buffer_pool_get_statistics();
+
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ //
+    //           Plain malloc and free          //
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ //
+    double system = churn(threads,
+        [] {
+            void* tile = malloc(TILE_BYTES);
+            if (tile) memset(tile, 0xFF, TILE_BYTES);
+            return tile;
+        },
+        [] (void*& tile) { free(tile); tile = nullptr; });
+
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ //
+    //                  Report                  //
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ //
+    std::cout
+    << "buffer pool:         " << tiles / pooled                                  << " tiles/s\n"
+    << "malloc / free:       " << tiles / system                                  << " tiles/s\n"
+    << "thread cache hits:   " << after.threadCacheHits - before.threadCacheHits  << "\n"
+    << "depot hits:          " << after.depotHits - before.depotHits              << "\n"
+    << "misses:              " << after.misses - before.misses                    << "\n"
+    << "oversized:           " << after.oversized - before.oversized              << "\n"
+    << "retained bytes:      " << after.retainedBytes                             << "\n";
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,153 @@
+/**
+ * @file buffer_stress.cpp
+ * @author Ryan Landvater
+ * @brief Concurrent Iris::Buffer append / read stress benchmark
+ * @version 2024.0.1
+ * @date 2024-11-04
+ *
+ * @copyright Copyright (c) 2023-24
+ *
+ * Hammers a single Iris::Buffer from N threads: writer threads append
+ * fixed-size chunks (relocating the buffer as it grows) while reader
+ * threads continuously take snapshots and read the committed bytes,
+ * as decoder and render threads do. Each reader verifies every byte it
+ * reads, so a use-after-free or torn publication is reported as a failure.
+ * The same workload is then run against a std::mutex guarded std::vector
+ * (a global-lock buffer) for a throughput comparison.
+ *
+ */
+
+// Include standard headers
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <iostream>
+
+// Include Iris Core header
+#include "IrisCore.hpp"
+
+// Workload parameters
+#define             CHUNK_BYTES     4096
+#define             CHUNKS_PER_WRITER 4096
+
+// Every chunk is filled with a single repeated byte value that identifies it.
+// A reader can therefore check any committed chunk without synchronizing
+// with the writers: a chunk must never contain more than one value.
+static bool verify (const uint8_t* data, size_t size)
+{
+    for (size_t offset = 0; offset + CHUNK_BYTES <= size; offset += CHUNK_BYTES)
+        for (size_t i = 1; i < CHUNK_BYTES; ++i)
+            if (data[offset + i] != data[offset]) return false;
+    return true;
+}
+
+struct Measurement {
+    double  seconds;
+    size_t  reads;
+    bool    valid;
+};
+
+// Run the workload on an Iris::Buffer
+static Measurement run_iris (unsigned writers, unsigned readers)
+{
+    Iris::Buffer buffer = Iris::Create_strong_buffer(CHUNK_BYTES);
+    std::atomic<unsigned>   writing {writers};
+    std::atomic<size_t>     reads   {0};
+    std::atomic<bool>       valid   {true};
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (unsigned w = 0; w < writers; ++w)
+        threads.emplace_back([&, w] {
+            uint8_t chunk [CHUNK_BYTES];
+            for (unsigned c = 0; c < CHUNKS_PER_WRITER; ++c) {
+                memset(chunk, static_cast<int>((w * CHUNKS_PER_WRITER + c) & 0xFF), CHUNK_BYTES);
+                // The copying append publishes the size only after the copy
+                Iris::Buffer_append(buffer, chunk, CHUNK_BYTES);
+            }
+            --writing;
+        });
+    for (unsigned r = 0; r < readers; ++r)
+        threads.emplace_back([&] {
+            while (writing.load()) {
+                // The snapshot keeps its block alive even if a writer relocates the buffer
+                Iris::BufferSnapshot snapshot = Iris::Buffer_get_snapshot(buffer);
+                if (!verify(static_cast<const uint8_t*>(snapshot.data), snapshot.size))
+                    valid = false;
+                ++reads;
+            }
+        });
+    for (auto& thread : threads) thread.join();
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    Iris::BufferSnapshot result = Iris::Buffer_get_snapshot(buffer);
+    bool complete = result.size == size_t(writers) * CHUNKS_PER_WRITER * CHUNK_BYTES;
+    return {elapsed.count(), reads.load(), valid && complete &&
+            verify(static_cast<const uint8_t*>(result.data), result.size)};
+}
+
+// Run the same workload on a global-lock buffer for comparison
+static Measurement run_mutex (unsigned writers, unsigned readers)
+{
+    std::vector<uint8_t>    buffer;
+    std::mutex              lock;
+    std::atomic<unsigned>   writing {writers};
+    std::atomic<size_t>     reads   {0};
+    std::atomic<bool>       valid   {true};
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (unsigned w = 0; w < writers; ++w)
+        threads.emplace_back([&, w] {
+            uint8_t chunk [CHUNK_BYTES];
+            for (unsigned c = 0; c < CHUNKS_PER_WRITER; ++c) {
+                memset(chunk, static_cast<int>((w * CHUNKS_PER_WRITER + c) & 0xFF), CHUNK_BYTES);
+                std::lock_guard<std::mutex> guard (lock);
+                buffer.insert(buffer.end(), chunk, chunk + CHUNK_BYTES);
+            }
+            --writing;
+        });
+    for (unsigned r = 0; r < readers; ++r)
+        threads.emplace_back([&] {
+            while (writing.load()) {
+                std::lock_guard<std::mutex> guard (lock);
+                if (!verify(buffer.data(), buffer.size())) valid = false;
+                ++reads;
+            }
+        });
+    for (auto& thread : threads) thread.join();
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return {elapsed.count(), reads.load(), valid.load()};
+}
+
+static void report (const char* name, const Measurement& m, unsigned writers)
+{
+    double megabytes = double(writers) * CHUNKS_PER_WRITER * CHUNK_BYTES / (1024. * 1024.);
+    std::cout << name
+    << "  append: "     << megabytes / m.seconds        << " MiB/s"
+    << "  reads: "      << m.reads / m.seconds          << " /s"
+    << "  "             << (m.valid ? "OK" : "CORRUPT") << "\n";
+}
+
+int main (int argc, char** argv)
+{
+    // Usage: buffer_stress [threads]; half write and half read
+    unsigned threads = argc > 1 ? static_cast<unsigned>(atoi(argv[1])) :
+                       std::max(2u, std::thread::hardware_concurrency());
+    unsigned writers = std::max(1u, threads / 2);
+    unsigned readers = std::max(1u, threads - writers);
+    std::cout << writers << " writer(s), " << readers << " reader(s)\n";
+
+    Measurement iris  = run_iris  (writers, readers);
+    Measurement mutex = run_mutex (writers, readers);
+    report ("Iris::Buffer   ", iris,  writers);
+    report ("std::mutex     ", mutex, writers);
+    return iris.valid ? EXIT_SUCCESS : EXIT_FAILURE;
+}
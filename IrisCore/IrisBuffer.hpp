@@ -13,8 +13,6 @@
 #ifndef IrisBuffer_hpp
 #define IrisBuffer_hpp
 
-//TODO: THIS IS CURRENTLY NOT THREAD SAFE! THERE CAN BE DATA RACES WITH THE CURRENT FORM. MUST UPDATE TO USE ATOMIC AND MUTEXES FOR THREAD SAFETY!
-
 namespace Iris {
 /**
  * @brief Private implementation of the reference counted data object used to wrap datablocks.
@@ -28,19 +26,53 @@ namespace Iris {
  * who want greater efficiency and control over datablocks. These methods
  * were created for the internal use by Iris Developers and come with some inherant risk.
  *
- * \warning __INTERNAL__Buffer is currently NOT thread safe. This will be fixed
- * in future updates. 
+ * \note __INTERNAL__Buffer follows single-writer / multi-reader semantics.
+ * Writers (append, prepare, resize, set_size, shrink_to_fit, change_strength)
+ * are serialized by a per-buffer write flag. The data block is reference counted
+ * through an aliasing handle whose stored pointer is the start of the buffer's
+ * data. A writer that relocates the block publishes the new handle and releases
+ * its reference to the old one, but the old block is only freed (returned to the
+ * buffer pool) once no snapshot still references it.
+ *
+ * The handle is published and copied under a per-buffer block flag held only for
+ * the length of the handle copy. No process-wide lock is taken, but readers may
+ * briefly spin on that flag, so snapshots are not lock-free. (std::atomic_load on
+ * std::shared_ptr is deliberately not used; common standard libraries back it
+ * with a process-wide table of mutexes.)
+ *
+ * Readers on other threads must read through snapshot(). It loads the committed
+ * size first (acquire) and then pins the block handle; the snapshot's data pointer
+ * is taken from the pinned handle, never from a separately published pointer. A
+ * writer publishes a larger block before publishing a size beyond the old capacity,
+ * and lowers the size before publishing a smaller block, so the pinned block always
+ * holds at least the snapshot's size. The snapshot's bytes remain valid for the life
+ * of the snapshot regardless of any concurrent append, prepare, or resize.
+ * data() and size() are for the writing thread, or for any thread once writing
+ * has finished.
+ *
+ * A slice holds a reference to the data block it was cut from rather than to
+ * the parent buffer, so the slice's bytes remain valid even if the parent
+ * later relocates or is destroyed. This does not apply to slices of a weak
+ * buffer, whose block is program-owned data that the slices cannot keep alive. For mapped buffers the block owns the file
+ * mapping, so the mapping is released with the last buffer or slice over it.
  */
 class __INTERNAL__Buffer {
-    BufferReferenceStrength         _strength   = REFERENCE_STRONG;
-    size_t                          _capacity   = 0;
-    size_t                          _size       = 0;
-    void* const                     _data       = nullptr;
+    std::atomic<BufferReferenceStrength>    _strength   = REFERENCE_STRONG;
+    std::atomic<size_t>                     _capacity   = 0;
+    std::atomic<size_t>                     _size       = 0;
+    const size_t                            _alignment  = 0;
+    void*                                   _data       = nullptr;  // writer thread only
+    std::shared_ptr<void>                   _block      = nullptr;  // guarded by _blockFlag
+    mutable std::atomic_flag                _blockFlag  = ATOMIC_FLAG_INIT;
+    std::atomic_flag                        _writer     = ATOMIC_FLAG_INIT;
     
 public:
     explicit __INTERNAL__Buffer     (BufferReferenceStrength) noexcept;
     explicit __INTERNAL__Buffer     (BufferReferenceStrength, size_t capacity) noexcept;
+    explicit __INTERNAL__Buffer     (BufferReferenceStrength, size_t capacity, BufferAlignment) noexcept;
     explicit __INTERNAL__Buffer     (BufferReferenceStrength, const void* const data, size_t bytes) noexcept;
+    explicit __INTERNAL__Buffer     (const Buffer& parent, size_t offset, size_t bytes) noexcept;
+    explicit __INTERNAL__Buffer     (const char* file_path, size_t offset, size_t bytes) noexcept;
     __INTERNAL__Buffer              (const __INTERNAL__Buffer&) = delete;
     __INTERNAL__Buffer& operator =  (const __INTERNAL__Buffer&) = delete;
    ~__INTERNAL__Buffer              ();
@@ -62,9 +94,20 @@ public:
      * 
      * @return REFERENCE_WEAK if the buffer only references the data and does not own it 
      * @return REFERENCE_STRONG if the buffer owns the data and controls the data lifetime
+     * @return REFERENCE_MAPPED if the buffer references a read-only mapping of a file range,
+     * including any slice of a mapped buffer
      */
     /// 
     BufferReferenceStrength get_strength    () const;
+    /**
+     * @brief Get the alignment guaranteed for the start of the data block.
+     * 
+     * This is resolved at creation (BUFFER_ALIGNMENT_PAGE becomes the system
+     * page size) and preserved across any reallocation of the data block.
+     * 
+     * @return size_t alignment in bytes; 0 if the allocator default is used
+     */
+    size_t      get_alignment               () const;
     /**
      * @brief Change the strength of the underlying reference. 
      * 
@@ -74,6 +117,22 @@ public:
      * If switched to WEAK reference, the buffer will give up the responsibility to free the data
      * and it now becomes the **responsibility of the program to avoid a memory leak**.
      * 
+     * \note Only a data block adopted from the program (by strengthening a weak buffer over
+     * malloc allocated data) may be weakened again; the program then releases it with free().
+     * Data blocks allocated by Iris are drawn from the buffer pool or the aligned allocator
+     * and cannot be released with free(). Weakening a buffer backed by such a block, including
+     * any buffer whose adopted block has since been relocated by a resize, returns IRIS_FAILURE
+     * and the buffer remains strong.
+     * 
+     * \note A slice cannot be strengthened as it does not own the start of its data block.
+     * This will return IRIS_FAILURE for slices.
+     * \note A weak buffer cannot be strengthened while any slice of it persists: a
+     * later relocation or destruction of the strong buffer would free memory those
+     * slices still reference. The block handle's reference count reveals them, and
+     * this returns IRIS_FAILURE with the buffer remaining weak.
+     * \note The strength of a REFERENCE_MAPPED buffer cannot be changed and
+     * no buffer can be changed to REFERENCE_MAPPED. This will return IRIS_FAILURE.
+     * 
      * @param strength_to_assign REFERENCE_WEAK or REFERENCE_STRONG
      */
     Result      change_strength             (BufferReferenceStrength strength_to_assign);
@@ -84,9 +143,26 @@ public:
      * If you wish to write into the buffer, use prepare() or append().
      * \sa end(), prepare(), and append()
      * 
+     * \warning The data of a REFERENCE_MAPPED buffer, or of a slice of one, is a read-only
+     * mapping; writing through this pointer results in an access violation.
+     * 
      * @return void* a pointer to the start of the internal data wrapped by the buffer.
      */
     void*       data                        () const;
+    /**
+     * @brief Capture the current data block and committed size for reading.
+     * 
+     * This is the only safe way to read the buffer from a thread other than the
+     * writer while writes may occur. The snapshot holds a reference to the data
+     * block, so the block is not freed or recycled by the buffer pool while the
+     * snapshot persists, even if the writer relocates the buffer in the meantime.
+     * Bytes appended after the snapshot was taken are not part of it.
+     * The committed size is loaded before the block is pinned, and the data
+     * pointer is that of the pinned block. \sa __INTERNAL__Buffer
+     * 
+     * @return BufferSnapshot referencing the block, its data, and the committed size
+     */
+    BufferSnapshot snapshot                 () const;
     /**
      * @brief Returns a pointer to the next unwritten location in the buffer. 
      * 
@@ -111,9 +187,13 @@ public:
      * reference the data within this buffer may become immediately invalid. You may check
      * if resize changed the buffer by evaluating a comparison between data() before calling
      * and data() after calling.
+     * Snapshots taken before the call remain valid. \sa snapshot()
+     * 
+     * \note The alignment of the data block is preserved. \sa get_alignment()
      * 
      * @param amount_of_bytes_to_prepare the number of bytes by which to expand the buffer
      * @return IRIS_SUCCESS on successful extension of buffer capacity
+     * @return IRIS_FAILURE for REFERENCE_MAPPED buffers (including slices of them), which are read-only
      */
     Result      prepare                     (size_t amount_of_bytes_to_prepare);
     /**
@@ -129,9 +209,15 @@ public:
      * reference the data within this buffer may become immediately invalid. You may check
      * if resize changed the buffer by evaluating a comparison between data() before calling
      * and data() after calling.
+     * Snapshots taken before the call remain valid. \sa snapshot()
+     * 
+     * \note The reserved bytes are counted within size() immediately, before the caller
+     * writes them. If other threads read the buffer concurrently, use append(void*, size_t),
+     * which copies the data first and only then publishes the new size.
      * 
      * @param append_by_bytes the number of bytes by which to expand the buffer
      * @return void* to the beginning of **writable space** where new data should be added.
+     * @return nullptr for REFERENCE_MAPPED buffers (including slices of them), which are read-only
      */
     void*       append                      (size_t append_by_bytes);
     /**
@@ -144,16 +230,20 @@ public:
      * reference the data within this buffer may become immediately invalid. You may check
      * if resize changed the buffer by evaluating a comparison between data() before calling
      * and data() after calling.
+     * Snapshots taken before the call remain valid. \sa snapshot()
      * 
      * @param data C-style pointer to data array
      * @param size Size of data in bytes
      * @return IRIS_SUCCESS on successful appending of data to end of buffer
+     * @return IRIS_FAILURE for REFERENCE_MAPPED buffers (including slices of them), which are read-only
      */
     Result      append                      (void* data, size_t size);
     /**
      * @brief Returns the current size of the buffer.
      * 
-     * This is distinct from the buffer capacity
+     * This is distinct from the buffer capacity. The size is published with release
+     * ordering after append(void*, size_t) has copied its data. Readers on other
+     * threads should use snapshot() to obtain a size and data block consistently.
      * \sa capacity()
      * 
      * @return size_t number of bytes written to the buffer.
@@ -195,13 +285,17 @@ public:
      * @brief Resize the underlying datablock
      * 
      * This is fundamentally different from calling set_size(size_t) as it actually
-     * changes the size of the backing data block by the kernel. Calling this method
-     * can invalidate the underlying data pointer.
+     * changes the size of the backing data block. Strong buffers draw the new block
+     * from the process-wide buffer pool and return the old block to it.
+     * Calling this method can invalidate the underlying data pointer.
      * \note You should use prepare() 
      * \warning this may invalidate any prior reference to the data() pointer. Any local variables that
      * reference the data within this buffer may become immediately invalid. You may check
      * if resize changed the buffer by evaluating a comparison between data() before calling
      * and data() after calling.
+     * Snapshots taken before the call remain valid. \sa snapshot()
+     * 
+     * \note The alignment of the data block is preserved. \sa get_alignment()
      * 
      * @param expected_size_bytes Size in bytes the buffer should be
      * @return IRIS_SUCCESS on successfully resizing the buffer object
@@ -211,6 +305,7 @@ public:
      * @brief Shrinks the underlying data block to fit the used space
      * 
      * This is equivalent to calling resize(size()).
+     * The alignment of the data block is preserved.
      * This will not invalidate any pointers and is generally a safe way
      * to reduce space consumption by buffers.
      * 
@@ -218,6 +313,88 @@ public:
      */
     Result      shrink_to_fit               ();
 };
+/**
+ * @brief Private implementation of the segmented buffer chain.
+ * 
+ * The chain holds a list of strong buffers (segments) drawn from the buffer pool.
+ * Segments are never reallocated once created, so pointers returned by append
+ * remain valid for the lifetime of the chain.
+ * 
+ * \note __INTERNAL__BufferChain follows the same single-writer / multi-reader
+ * semantics as __INTERNAL__Buffer. Appends are serialized by the write flag.
+ * The segment list itself is guarded by a shared mutex: an append holds it
+ * exclusively only while adding a segment, and get_segments() and flatten()
+ * hold it shared, so readers never observe the list mid-reallocation.
+ */
+class __INTERNAL__BufferChain {
+    const size_t                            _segSize    = 0;
+    std::vector<Buffer>                     _segments;                  // guarded by _segLock
+    mutable std::shared_mutex               _segLock;
+    std::atomic<size_t>                     _size       = 0;
+    std::atomic_flag                        _writer     = ATOMIC_FLAG_INIT;
+    
+public:
+    explicit __INTERNAL__BufferChain(size_t segment_size) noexcept;
+    __INTERNAL__BufferChain         (const __INTERNAL__BufferChain&) = delete;
+    __INTERNAL__BufferChain& operator = (const __INTERNAL__BufferChain&) = delete;
+   ~__INTERNAL__BufferChain         ();
+    /**
+     * @brief Expands the **size** of the chain by a contiguous writable region.
+     * 
+     * If the region does not fit within the remaining space of the last segment,
+     * a new segment of max(segment size, append_by_bytes) bytes is added and the
+     * unused tail of the previous segment is left empty. No previously written
+     * data is moved.
+     * 
+     * @param append_by_bytes the number of contiguous bytes by which to expand the chain
+     * @return void* to the beginning of **writable space** where new data should be added.
+     */
+    void*       append                      (size_t append_by_bytes);
+    /**
+     * @brief Appends the end of the chain by copying data into it.
+     * 
+     * Unlike append(size_t), the copy is split across as many segments as
+     * required and the data need not be contiguous within the chain.
+     * 
+     * @param data C-style pointer to data array
+     * @param size Size of data in bytes
+     * @return IRIS_SUCCESS on successful appending of data to end of chain
+     */
+    Result      append                      (const void* data, size_t size);
+    /**
+     * @brief Returns the total number of bytes written across all segments.
+     * 
+     * @return size_t number of bytes written to the chain.
+     */
+    size_t      size                        () const;
+    /**
+     * @brief Returns the size in bytes of newly created segments.
+     * 
+     * @return size_t segment size in bytes
+     */
+    size_t      segment_size                () const;
+    /**
+     * @brief Returns iovec-style views of the written bytes of each segment, in order.
+     * 
+     * Safe to call from any thread while another thread appends. The views
+     * cover the bytes committed when the call was made; segments are never
+     * reallocated, so the views remain valid for the lifetime of the chain.
+     * 
+     * @return BufferSegments list of segment data pointers and sizes
+     */
+    BufferSegments get_segments             () const;
+    /**
+     * @brief Produce a contiguous buffer containing the chain's data.
+     * 
+     * If the chain holds a single segment, a slice of that segment is returned
+     * without copying. Otherwise, the segments are copied into a new strong buffer.
+     * Safe to call from any thread while another thread appends; bytes appended
+     * after the call begins are not included.
+     * 
+     * @return Buffer containing size() bytes of contiguous data
+     */
+    Buffer      flatten                     () const;
+};
 } // END IRIS NAMESPACE
 
 #endif /* IrisBuffer_hpp */
@@ -11,12 +11,20 @@
  */
 
 #include <stdint.h>
+#include <atomic>
 #include <vector>
 #include <map>
 #include <unordered_map>
 #include <thread>
 #include <shared_mutex>
 #include <functional>
+#include <future>
+#if __has_include(<version>)
+#include <version>
+#endif
+#if defined(__cpp_impl_coroutine) && defined(__cpp_lib_coroutine)
+#include <coroutine>
+#endif
 #include "IrisTypes.hpp"
 
 #ifndef IrisCore_h
@@ -62,6 +70,8 @@ Viewer  create_viewer                   (const ViewerCreateInfo&) noexcept;
  * 
  * Unbind the viewer before destroying the view or allow the viewer to exit scope
  * and it will automatically unbind the surface.
+ * On Linux, the viewer binds an offscreen render target instead of a window
+ * (see ViewerBindExternalSurfaceInfo) and may be used on headless systems.
  * \note The provided surface must outlive the viewer once bound.
  * If the viewer should outlive the surface, the
  * viewer can be unbound via viewer_unbind_surface (const Viewer&);
@@ -94,6 +104,50 @@ Result viewer_window_will_resize        (const ViewerResizeSurfaceInfo& viewer)
  */
 Result viewer_window_resized            (const Viewer& viewer) noexcept;
 
+/**
+ * @brief Read back the most recently composed frame as pixels.
+ * 
+ * Frames are read back from the render target into one of two alternating
+ * readback buffers, so the last completed frame can be copied out while the
+ * next frame renders and this call never waits on the frame in progress.
+ * The frame is info.width x info.height pixels, row-major, top row first,
+ * without padding between rows. This allows server-side rendering, such as
+ * streaming viewer frames to thin clients from a headless (Linux) viewer.
+ * 
+ * Translate and zoom calls are applied by the render thread, so a frame read
+ * immediately after them may predate them. To wait for a frame reflecting the
+ * change, poll until info.presented is later than the time of the call
+ * (std::chrono::steady_clock microseconds, as in FrameStatistics).
+ * 
+ * \note If the provided buffer is a strong buffer of sufficient capacity,
+ * it is reused and no allocation is made. Otherwise, a new strong buffer
+ * is assigned. Reuse the same buffer when streaming frames.
+ * 
+ * @param viewer Iris::Viewer handle
+ * @param format pixel format of the returned frame
+ * @param frame buffer to receive the frame pixels
+ * @param info structure to populate with the frame extent, index, and presentation time
+ * @return IRIS_SUCCESS on success
+ * @return IRIS_UNINITIALIZED if no frame has been composed since the surface was bound
+ * @return IRIS_FAILURE if the viewer is not bound to a surface or the format is undefined
+ */
+Result viewer_read_frame                (const Viewer& viewer, Format format, Buffer& frame, FrameReadInfo& info) noexcept;
+
+/**
+ * @brief Get the pipeline timings of the viewer's recent frames.
+ * 
+ * The viewer records each composed frame in a ring buffer of the 256 most
+ * recent frames. Recording is always enabled and costs a few timestamp writes
+ * per frame, so this may be polled in production to alert on jank.
+ * \sa FrameStatistics
+ * 
+ * @param viewer Iris::Viewer handle
+ * @param frames list to populate with the recent frames, oldest first
+ * @return IRIS_SUCCESS on success
+ * @return IRIS_FAILURE if the viewer is not bound to a surface
+ */
+Result viewer_get_frame_statistics      (const Viewer& viewer, FrameStatisticsList& frames) noexcept;
+
 /**
  * @brief Create and open a slide for viewing. 
  * 
@@ -130,6 +184,66 @@ Result viewer_engine_translate          (const Viewer& viewer, const ViewerTrans
  */
 Result viewer_engine_zoom               (const Viewer& viewer, const ViewerZoomScope&) noexcept;
 
+/**
+ * @brief Get the counters of read requests of the slide opened in a viewer.
+ * 
+ * @param viewer Iris::Viewer handle
+ * @param statistics structure to populate with the read counters
+ * @return IRIS_SUCCESS on success
+ * @return IRIS_FAILURE if no slide is open in the viewer
+ */
+Result viewer_get_read_statistics       (const Viewer& viewer, SlideReadStatistics& statistics) noexcept;
+
+/**
+ * @brief Configure predictive tile prefetching for a viewer.
+ * 
+ * Velocity based prefetching is enabled with default parameters when the viewer
+ * is created; use this to tune or disable it.
+ * \sa ViewerPrefetchInfo
+ * 
+ * @param info prefetch parameters including the Iris::Viewer handle
+ */
+Result viewer_configure_prefetch        (const ViewerPrefetchInfo& info) noexcept;
+
+/**
+ * @brief Begin recording the viewer's session to a file.
+ * 
+ * All subsequent slide open / close, resize, translate, and zoom calls made on the viewer
+ * are written to the file with microsecond timestamps until recording ends. The recording
+ * can be replayed with viewer_replay_recording to turn the perceived smoothness of the
+ * session into measurable numbers. Recording adds no measurable cost to the calls.
+ * 
+ * @param viewer Iris::Viewer handle
+ * @param file_path path of the recording file to create (overwritten if it exists)
+ * @return IRIS_SUCCESS on success
+ * @return IRIS_FAILURE if the file cannot be created or the viewer is already recording
+ */
+Result viewer_begin_recording           (const Viewer& viewer, const char* file_path) noexcept;
+
+/**
+ * @brief End the viewer's session recording and close the recording file.
+ * 
+ * @param viewer Iris::Viewer handle
+ * @return IRIS_SUCCESS on success
+ * @return IRIS_UNINITIALIZED if the viewer is not recording
+ */
+Result viewer_end_recording             (const Viewer& viewer) noexcept;
+
+/**
+ * @brief Replay a recorded session on a viewer and measure it.
+ * 
+ * This blocks until the replay completes. The viewer must be bound to a surface;
+ * a headless (Linux offscreen) viewer may be used to replay sessions on CI systems.
+ * Any slide open in the viewer is closed first. Use realtime = false for
+ * deterministic, run-to-run comparable tile and cache measurements.
+ * 
+ * @param info replay information including the Iris::Viewer handle
+ * @param report structure to populate with frame latency percentiles, missed tiles, and cache counters
+ * @return IRIS_SUCCESS on completion of the replay
+ * @return IRIS_FAILURE if the recording cannot be read or a recorded slide cannot be opened
+ */
+Result viewer_replay_recording          (const ViewerReplayInfo& info, ViewerReplayReport& report) noexcept;
+
 /**
  * @brief Insert an image slide annotation into the current active slide at the location within the screen.
  * 
@@ -137,6 +251,16 @@ Result viewer_engine_zoom               (const Viewer& viewer, const ViewerZoomS
  */
 Result viewer_annotate_slide            (const Viewer& viewer, const SlideAnnotation&) noexcept;
 
+/**
+ * @brief Get the current occupancy of the tile cache of the slide opened in a viewer.
+ * 
+ * @param viewer Iris::Viewer handle
+ * @param statistics structure to populate with the per-tier cache entries, bytes, and counters
+ * @return IRIS_SUCCESS on success
+ * @return IRIS_FAILURE if no slide is open in the viewer
+ */
+Result viewer_get_cache_statistics      (const Viewer& viewer, SlideCacheStatistics& statistics) noexcept;
+
 //  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ //
 //     Iris Slide Image Handler                                             //
 //  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ //
@@ -147,10 +271,18 @@ Result viewer_annotate_slide            (const Viewer& viewer, const SlideAnnota
  * 
  * The Slide object has a variety of interal functionalities in addition to
  * mapping the WSI file. This includes asynchronous non-blocking read threads
- * that load the slide tile image data. 
+ * that load the slide tile image data. Reads are serviced from a priority queue
+ * (see TileReadPriority) so visible tiles at the current layer always outrank
+ * placeholders and prefetch. Each time the view changes, requests are re-prioritized
+ * and requests for tiles that have left the view are cancelled (see CancelToken),
+ * whether still queued or in flight.
+ * 
+ * A slide does not require a viewer, window, or display. Slides created
+ * with this method may be read directly (see slide_read_tile) on headless
+ * systems such as analysis servers and batch jobs.
  * 
  * \note Iris::viewer_open_slide(const Viewer& viewer, const Slide&) is the
- * preferred method as it allows the Iris Render Engine to configure optional
+ * preferred method **for viewing** as it allows the Iris Render Engine to configure optional
  * performance parameters.
  * 
  * @param info Iris::SlideOpenInfo structure
@@ -160,6 +292,340 @@ Result viewer_annotate_slide            (const Viewer& viewer, const SlideAnnota
  */
 Slide create_slide                      (const SlideOpenInfo& info);
 
+/**
+ * @brief Get the extent of a slide, including the extent of each of its layers.
+ * 
+ * @param slide Iris::Slide handle
+ * @param extent structure to populate with the slide and layer extents
+ * @return IRIS_SUCCESS on success
+ * @return IRIS_FAILURE if the slide handle is invalid
+ */
+Result slide_get_extent                 (const Slide& slide, Extent& extent) noexcept;
+
+/**
+ * @brief Read and decode a single slide tile without a viewer.
+ * 
+ * The tile is served from the slide's tile cache if present; otherwise it is read
+ * and decoded on the slide's read threads at the given priority and this call
+ * blocks until it completes. The returned buffer holds 256 x 256 pixels in
+ * the requested format, row-major, and is safe to retain after the slide is destroyed.
+ * 
+ * @param slide Iris::Slide handle
+ * @param layer index of the layer within Extent::layers
+ * @param x horizontal tile index within the layer [0, LayerExtent::xTiles)
+ * @param y vertical tile index within the layer [0, LayerExtent::yTiles)
+ * @param format pixel format of the returned tile
+ * @param priority scheduling priority of the read relative to the slide's other pending reads
+ * @param cancel optional token; setting it abandons the read and returns a nullptr
+ * @return Valid Iris::Buffer handle containing the decoded tile on success
+ * @return Nullptr on failure, such as an out of range tile index or an undefined format
+ */
+Buffer slide_read_tile                  (const Slide& slide, uint32_t layer, uint32_t x, uint32_t y,
+                                         Format format = FORMAT_R8G8B8A8, TileReadPriority priority = TILE_READ_PRIORITY_VISIBLE,
+                                         const CancelToken& cancel = nullptr) noexcept;
+
+/**
+ * @brief Read and decode a batch of tiles from one layer into a single tensor buffer.
+ * 
+ * The whole batch is submitted to the slide's read threads at once. Tiles are
+ * read in file order rather than request order, and tiles whose encoded bytes are
+ * adjacent in the slide file are coalesced into a single read. Each decoded tile is
+ * written directly into its place within the output, which is laid out as an
+ * NHWC tensor: N = tiles.size() in request order, H = W = 256, and C = the
+ * number of channels in the requested format (3 or 4), one byte per channel.
+ * 
+ * \note Prefer this to repeated slide_read_tile calls for machine learning
+ * batches; the per-tile scheduling and locking cost is paid once per batch.
+ * 
+ * @param slide Iris::Slide handle
+ * @param layer index of the layer within Extent::layers
+ * @param tiles tile indices within the layer, in the order they should appear in the output
+ * @param format pixel format of the returned tiles
+ * @param priority scheduling priority of the read relative to the slide's other pending reads
+ * @param cancel optional token; setting it abandons the remaining reads and returns a nullptr
+ * @return Valid Iris::Buffer handle of N x 256 x 256 x C bytes on success
+ * @return Nullptr on failure, such as any out of range tile index
+ */
+Buffer slide_read_tiles                 (const Slide& slide, uint32_t layer, const TileCoordinatesList& tiles,
+                                         Format format = FORMAT_R8G8B8A8, TileReadPriority priority = TILE_READ_PRIORITY_VISIBLE,
+                                         const CancelToken& cancel = nullptr) noexcept;
+
+/**
+ * @brief Read a region of a slide at an arbitrary downsample.
+ * 
+ * The tiles covering the region on the nearest finer layer are read and
+ * resampled in parallel across the slide's read threads, each producing
+ * its portion of the output with a vectorized (SIMD) filter. The output
+ * is row-major in the requested format without padding between rows.
+ * \sa SlideRegionReadInfo
+ * 
+ * @param slide Iris::Slide handle
+ * @param info region, target downsample, output format, and filter
+ * @param priority scheduling priority of the read relative to the slide's other pending reads
+ * @param cancel optional token; setting it abandons the read and returns a nullptr
+ * @return Valid Iris::Buffer handle containing the resampled region on success
+ * @return Nullptr on failure, such as a region outside the slide or a downsample below 1
+ */
+Buffer slide_read_region                (const Slide& slide, const SlideRegionReadInfo& info,
+                                         TileReadPriority priority = TILE_READ_PRIORITY_VISIBLE,
+                                         const CancelToken& cancel = nullptr) noexcept;
+
+/**
+ * @brief Asynchronously read and decode a single slide tile.
+ * 
+ * This is the non-blocking equivalent of slide_read_tile. The request is queued on the
+ * slide's read threads and this call returns immediately; no calling thread is held while
+ * the read is in flight, so a few threads may keep thousands of reads outstanding.
+ * 
+ * @param slide Iris::Slide handle
+ * @param layer index of the layer within Extent::layers
+ * @param x horizontal tile index within the layer
+ * @param y vertical tile index within the layer
+ * @param format pixel format of the returned tile
+ * @param callback completion callback invoked once on a read thread. \sa SlideReadCallback
+ * @param priority scheduling priority of the read relative to the slide's other pending reads
+ * @param cancel optional token to cancel the read
+ * @return IRIS_SUCCESS if the read was queued; the callback will be invoked
+ * @return IRIS_FAILURE if the read could not be queued; the callback will not be invoked
+ */
+Result slide_read_tile_async            (const Slide& slide, uint32_t layer, uint32_t x, uint32_t y, Format format,
+                                         const SlideReadCallback& callback, TileReadPriority priority = TILE_READ_PRIORITY_VISIBLE,
+                                         const CancelToken& cancel = nullptr) noexcept;
+
+/**
+ * @brief Asynchronously read a batch of tiles into a single NHWC tensor buffer.
+ * 
+ * This is the non-blocking equivalent of slide_read_tiles. The tile list is copied
+ * and need not outlive the call.
+ * 
+ * @return IRIS_SUCCESS if the batch was queued; the callback will be invoked
+ * @return IRIS_FAILURE if the batch could not be queued; the callback will not be invoked
+ */
+Result slide_read_tiles_async           (const Slide& slide, uint32_t layer, const TileCoordinatesList& tiles, Format format,
+                                         const SlideReadCallback& callback, TileReadPriority priority = TILE_READ_PRIORITY_VISIBLE,
+                                         const CancelToken& cancel = nullptr) noexcept;
+
+/**
+ * @brief Asynchronously read a region of a slide at an arbitrary downsample.
+ * 
+ * This is the non-blocking equivalent of slide_read_region.
+ * 
+ * @return IRIS_SUCCESS if the read was queued; the callback will be invoked
+ * @return IRIS_FAILURE if the read could not be queued; the callback will not be invoked
+ */
+Result slide_read_region_async          (const Slide& slide, const SlideRegionReadInfo& info,
+                                         const SlideReadCallback& callback, TileReadPriority priority = TILE_READ_PRIORITY_VISIBLE,
+                                         const CancelToken& cancel = nullptr) noexcept;
+
+/**
+ * @brief Future variant of slide_read_tile_async.
+ * 
+ * @return std::future resolving to the decoded tile, or a nullptr on failure or cancellation
+ */
+std::future<Buffer> slide_read_tile_future   (const Slide& slide, uint32_t layer, uint32_t x, uint32_t y,
+                                              Format format = FORMAT_R8G8B8A8, TileReadPriority priority = TILE_READ_PRIORITY_VISIBLE,
+                                              const CancelToken& cancel = nullptr) noexcept;
+
+/**
+ * @brief Future variant of slide_read_tiles_async.
+ * 
+ * @return std::future resolving to the NHWC tensor buffer, or a nullptr on failure or cancellation
+ */
+std::future<Buffer> slide_read_tiles_future  (const Slide& slide, uint32_t layer, const TileCoordinatesList& tiles,
+                                              Format format = FORMAT_R8G8B8A8, TileReadPriority priority = TILE_READ_PRIORITY_VISIBLE,
+                                              const CancelToken& cancel = nullptr) noexcept;
+
+/**
+ * @brief Future variant of slide_read_region_async.
+ * 
+ * @return std::future resolving to the resampled region, or a nullptr on failure or cancellation
+ */
+std::future<Buffer> slide_read_region_future (const Slide& slide, const SlideRegionReadInfo& info,
+                                              TileReadPriority priority = TILE_READ_PRIORITY_VISIBLE,
+                                              const CancelToken& cancel = nullptr) noexcept;
+
+/**
+ * @brief Get the current occupancy of a slide's tile cache.
+ * 
+ * For slides using the shared tile cache, only this slide's entries are reported.
+ * 
+ * @param slide Iris::Slide handle
+ * @param statistics structure to populate with the per-tier cache entries, bytes, and counters
+ * @return IRIS_SUCCESS on success
+ * @return IRIS_FAILURE if the slide handle is invalid
+ */
+Result slide_get_cache_statistics       (const Slide& slide, SlideCacheStatistics& statistics) noexcept;
+
+/**
+ * @brief Get the counters of a slide's read requests, including cancelled versus completed reads.
+ * 
+ * @param slide Iris::Slide handle
+ * @param statistics structure to populate with the read counters
+ * @return IRIS_SUCCESS on success
+ * @return IRIS_FAILURE if the slide handle is invalid
+ */
+Result slide_get_read_statistics        (const Slide& slide, SlideReadStatistics& statistics) noexcept;
+
+/**
+ * @brief Configure the process-wide tile cache shared between slides.
+ * 
+ * Slides opened with SlideOpenInfo::SLIDE_CACHE_SHARED (whether by create_slide
+ * or viewer_open_slide) draw from this cache. The shared cache is created on the
+ * first shared slide with default parameters if it has not been configured.
+ * Reducing the budget immediately evicts unreferenced tiles to fit.
+ * 
+ * @param info shared tile cache parameters
+ * @return IRIS_SUCCESS on successful configuration
+ */
+Result configure_shared_tile_cache      (const SharedTileCacheInfo& info) noexcept;
+
+/**
+ * @brief Get the current occupancy of the process-wide shared tile cache.
+ * 
+ * @param statistics structure to populate with the per-tier cache entries, bytes, and counters
+ * @return IRIS_SUCCESS on success
+ */
+Result shared_tile_cache_get_statistics (SlideCacheStatistics& statistics) noexcept;
+
+/**
+ * @brief Configure the persistent on-disk tile cache.
+ * 
+ * Once configured, slides consult the disk cache before network or source-file
+ * reads and insert tiles they read into it. This should be configured before
+ * slides are opened; slides already open begin using the cache on their next read.
+ * An eviction sweep is performed immediately if the directory exceeds the budget.
+ * 
+ * @param info disk cache directory and budget. A null directory disables the disk cache.
+ * @return IRIS_SUCCESS on successful configuration
+ * @return IRIS_FAILURE if the directory cannot be created or is not writable
+ */
+Result configure_disk_tile_cache        (const DiskTileCacheInfo& info) noexcept;
+
+/**
+ * @brief Sweep the on-disk tile cache.
+ * 
+ * Removes abandoned temporary files and corrupt entries, then evicts the least
+ * recently accessed entries until the directory fits within its budget. Sweeps
+ * also run automatically in the background; call this to force one, for example
+ * at application start.
+ * 
+ * @return IRIS_SUCCESS on completion of the sweep
+ * @return IRIS_UNINITIALIZED if no disk cache is configured
+ */
+Result disk_tile_cache_sweep            () noexcept;
+
+#if defined(__cpp_impl_coroutine) && defined(__cpp_lib_coroutine)
+/**
+ * @brief Awaitable wrapper around an asynchronous slide read (C++20 coroutines).
+ * 
+ * Suspends the awaiting coroutine, submits the read via the corresponding
+ * slide_read_*_async method, and resumes the coroutine directly on the Iris read
+ * thread that completes the read; there is no additional thread hop. The completion
+ * callback captures only the awaitable and the coroutine handle, which fits within
+ * std::function's small-object storage, so no allocation is made per await.
+ * The awaited value is the read buffer, or a nullptr on failure or cancellation.
+ * 
+ * \note Do not construct directly; use slide_await_tile, slide_await_tiles,
+ * or slide_await_region.
+ * \warning The coroutine resumes on an Iris read thread and must not block it.
+ * Transfer to your own executor before performing lengthy work.
+ */
+template <class __Submit>
+class __INTERNAL__SlideReadAwaitable {
+    __Submit                        _submit;
+    Buffer                          _buffer     = nullptr;
+    
+public:
+    explicit __INTERNAL__SlideReadAwaitable (__Submit&& submit) noexcept :
+    _submit (std::move(submit)) {}
+    bool        await_ready                 () const noexcept {return false;}
+    bool        await_suspend               (std::coroutine_handle<> handle) noexcept
+    {
+        // The read may complete and resume (or even destroy) the coroutine
+        // before the submission returns. Keep everything needed after
+        // submitting on this stack frame rather than within the awaitable.
+        auto submit = std::move(_submit);
+        Result queued = submit(SlideReadCallback([this, handle](const Result&, const Buffer& buffer) {
+            _buffer = buffer;
+            handle.resume();
+        }));
+        // If the read could not be queued the callback is never invoked;
+        // do not suspend and resume with a nullptr.
+        return queued == IRIS_SUCCESS;
+    }
+    Buffer      await_resume                () noexcept {return std::move(_buffer);}
+};
+/**
+ * @brief Awaitable variant of slide_read_tile_async.
+ * 
+ * Usage: Iris::Buffer tile = co_await Iris::slide_await_tile(slide, layer, x, y);
+ */
+inline auto slide_await_tile            (const Slide& slide, uint32_t layer, uint32_t x, uint32_t y,
+                                         Format format = FORMAT_R8G8B8A8, TileReadPriority priority = TILE_READ_PRIORITY_VISIBLE,
+                                         const CancelToken& cancel = nullptr) noexcept
+{
+    return __INTERNAL__SlideReadAwaitable ([=](const SlideReadCallback& callback) {
+        return slide_read_tile_async(slide, layer, x, y, format, callback, priority, cancel);
+    });
+}
+/**
+ * @brief Awaitable variant of slide_read_tiles_async.
+ * 
+ * The tile list is copied into the awaitable and need not outlive the call.
+ */
+inline auto slide_await_tiles           (const Slide& slide, uint32_t layer, const TileCoordinatesList& tiles,
+                                         Format format = FORMAT_R8G8B8A8, TileReadPriority priority = TILE_READ_PRIORITY_VISIBLE,
+                                         const CancelToken& cancel = nullptr) noexcept
+{
+    return __INTERNAL__SlideReadAwaitable ([=](const SlideReadCallback& callback) {
+        return slide_read_tiles_async(slide, layer, tiles, format, callback, priority, cancel);
+    });
+}
+/**
+ * @brief Awaitable variant of slide_read_region_async.
+ */
+inline auto slide_await_region          (const Slide& slide, const SlideRegionReadInfo& info,
+                                         TileReadPriority priority = TILE_READ_PRIORITY_VISIBLE,
+                                         const CancelToken& cancel = nullptr) noexcept
+{
+    return __INTERNAL__SlideReadAwaitable ([=](const SlideReadCallback& callback) {
+        return slide_read_region_async(slide, info, callback, priority, cancel);
+    });
+}
+#endif
+
+//  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ //
+//      Engine Tracing                                                      //
+//  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ //
+
+/**
+ * @brief Begin recording a trace of engine activity on every Iris thread.
+ * 
+ * Tracing is compiled into all Iris binaries and is opt-in at runtime. While
+ * inactive, each instrumentation point costs a single branch on a process-wide
+ * flag, so production binaries may be traced on demand without rebuilding.
+ * While active, spans are recorded for the selected categories (tile reads,
+ * decodes, cache inserts and evictions, buffer allocations, and frames).
+ * 
+ * @param info categories and per-thread event capacity
+ * @return IRIS_SUCCESS on success
+ * @return IRIS_FAILURE if a trace is already being recorded
+ */
+Result engine_trace_begin               (const EngineTraceInfo& info) noexcept;
+
+/**
+ * @brief End the engine trace and write it as Chrome trace-event JSON.
+ * 
+ * The file may be opened with Perfetto (ui.perfetto.dev) or chrome://tracing.
+ * Each Iris thread appears as a named track (render, read, and decode threads).
+ * 
+ * @param file_path path of the JSON file to write (overwritten if it exists)
+ * @return IRIS_SUCCESS on successfully writing the trace
+ * @return IRIS_UNINITIALIZED if no trace is being recorded
+ * @return IRIS_FAILURE if the file cannot be written; the trace is discarded
+ */
+Result engine_trace_end                 (const char* file_path) noexcept;
+
 //  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ //
 //      Data Buffer Wrapper                                                 //
 //  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ //
@@ -186,12 +652,34 @@ Buffer  Create_strong_buffer        ();
  * data (once allocated) as long as one copy persists. The size will be 0, despite 
  * the capacity being defined.
  * 
+ * \note The data block is drawn from the process-wide buffer pool.
+ * \sa Buffer_pool_configure
+ * 
  * @param buffer_size_in_bytes the initial **capacity** (in bytes). The internal 'size' is '0' bytes
  * @return Valid Iris::Buffer handle with size 0 bytes on success
  * @return Nullptr on failure
  */
 Buffer  Create_strong_buffer        (size_t buffer_size_in_bytes);
 
+/**
+ * @brief Create a **strong** blank buffer whose data block is aligned to @ref alignment.
+ * 
+ * This behaves as Create_strong_buffer(size_t) but guarantees the alignment of
+ * data() and preserves it whenever the data block is reallocated (prepare, append,
+ * resize, and shrink_to_fit). Use BUFFER_ALIGNMENT_SIMD or BUFFER_ALIGNMENT_CACHE_LINE
+ * for pixel buffers consumed by vectorized kernels and BUFFER_ALIGNMENT_PAGE for
+ * DMA-style uploads.
+ * 
+ * \note Blocks aligned to at most a cache line are drawn from the buffer pool;
+ * page aligned blocks are allocated directly from the system.
+ * 
+ * @param buffer_size_in_bytes the initial **capacity** (in bytes). The internal 'size' is '0' bytes
+ * @param alignment required alignment of the data block. Must be a power of two or BUFFER_ALIGNMENT_PAGE.
+ * @return Valid Iris::Buffer handle with size 0 bytes on success
+ * @return Nullptr on failure, such as an alignment that is not a power of two
+ */
+Buffer  Create_aligned_strong_buffer(size_t buffer_size_in_bytes, BufferAlignment alignment);
+
 /**
  * @brief Create a **strong** buffer and copy the data pointed to by @ref dataptr and @ref bytes in length (in bytes).
  * 
@@ -199,6 +687,8 @@ Buffer  Create_strong_buffer        (size_t buffer_size_in_bytes);
  * data (once allocated) as long as one copy persists. The data pointed to by dataptr
  * will be copied into the returned buffer and **the data source can be safely freed at any time.**
  * 
+ * \note The data block is drawn from the process-wide buffer pool.
+ * 
  * @param data_ptr pointer to raw bytes to be copied into the new buffer
  * @param bytes number of bytes to copy into the buffer. This will be resulting buffer size.
  * @return Valid Iris::Buffer handle on success
@@ -226,6 +716,60 @@ Buffer Copy_strong_buffer_from_data (const void* data_ptr, size_t bytes);
  */
 Buffer  Wrap_weak_buffer_fom_data   (const void* const data_ref, size_t bytes);
 
+/**
+ * @brief Create a **mapped** buffer backed by a read-only memory mapping of a file range.
+ * 
+ * The buffer data is the file's bytes [offset, offset + bytes) mapped into the
+ * process address space. No data is copied on creation; pages are faulted in from
+ * the page cache on first access and may be evicted by the operating system under
+ * memory pressure without counting against the process' heap. The mapping is released
+ * when the last copy of the buffer is destroyed. The offset need not be page aligned.
+ * 
+ * \note Mapped buffers are read-only and cannot be expanded, written into, or
+ * have their strength changed. Use Buffer_slice to split a mapped range into
+ * sub-ranges (such as individual tiles) without additional mappings.
+ * \warning Truncating the file while mapped buffers persist results in access
+ * violations (SIGBUS) when the removed pages are read.
+ * 
+ * @param file_path path to the file to map
+ * @param offset byte offset of the range within the file
+ * @param bytes length of the range in bytes. This will be the resulting buffer size.
+ * @return Valid Iris::Buffer (**mapped ownership**) handle on success
+ * @return Nullptr on failure, such as a range extending beyond the end of the file
+ */
+Buffer  Map_buffer_from_file        (const char* file_path, size_t offset, size_t bytes);
+
+/**
+ * @brief Create a zero-copy slice of a buffer sharing the parent's storage.
+ * 
+ * The returned buffer is a **weak** reference to the range [offset, offset + bytes)
+ * of the parent's current data block and holds a reference to that block. If the
+ * block is owned by Iris (a strong or mapped parent), the sliced bytes persist for
+ * as long as any slice persists, even if the parent is destroyed. This is useful to
+ * split a single read of a multi-tile byte range into per-tile buffers without copying.
+ * 
+ * \warning Slices of a weak parent (such as from Wrap_weak_buffer_fom_data) do
+ * not extend the lifetime of the wrapped data; the program still owns it and must
+ * keep it alive for as long as any slice persists. Such a parent cannot be
+ * strengthened while any of its slices persist. \sa Buffer_change_strength
+ * 
+ * \note Slices cannot be expanded or strengthened. Writes into a slice are
+ * visible through the parent and vice versa while the parent keeps that block.
+ * \note A slice of a REFERENCE_MAPPED buffer is itself REFERENCE_MAPPED and
+ * read-only, as its bytes are the parent's read-only file mapping.
+ * \note If the parent later relocates its data block (prepare, append, or resize
+ * beyond its capacity), existing slices keep the original block: they remain valid
+ * but no longer observe the parent's writes. Prepare the parent's capacity before
+ * slicing if writes must remain shared.
+ * 
+ * @param buffer Iris::Buffer handle to slice
+ * @param offset byte offset of the slice start within the parent's data
+ * @param bytes length of the slice in bytes. The slice size and capacity will be this length.
+ * @return Valid Iris::Buffer (**weak ownership**, or **mapped** if the parent is mapped) handle on success
+ * @return Nullptr if the range extends beyond the parent's size
+ */
+Buffer  Buffer_slice                (const Buffer& buffer, size_t offset, size_t bytes);
+
 /**
  * @brief Write data into a buffer in a safe manner. 
  * 
@@ -237,11 +781,19 @@ Buffer  Wrap_weak_buffer_fom_data   (const void* const data_ref, size_t bytes);
  * If the reference is **STRONG**, this method will expose the begining of the next writable segment and will
  * expand the buffer if there is insufficient space. The buffer's internal size metric will reflect the new data.
  * 
+ * \note Mapped buffers are read-only; this returns a NULL-pointer for REFERENCE_MAPPED buffers,
+ * including slices of mapped buffers.
+ * 
  * \warning If the reference is **weak** and if there is insufficient space within
  * the bufferthis will throw an exception (as weak buffer wrappers are not permitted to expand a buffer).
  * **If you are worried about a buffer overflow, you may consider strengthening the buffer reference
  * to allow for expansion.**
  *
+ * \warning This is **single-writer only** and is not safe alongside snapshot readers.
+ * The reserved bytes are counted in the buffer size before they are written, so a
+ * concurrent snapshot may include unwritten bytes, and a write by another thread may
+ * relocate the buffer and invalidate the returned pointer. When other threads write
+ * or read concurrently, use Buffer_append instead.
  *
  * @param buffer Iris::Buffer handle
  * @param bytes number of bytes to prepare for writing; size of the buffer will be expanded by this number of bytes
@@ -250,25 +802,142 @@ Buffer  Wrap_weak_buffer_fom_data   (const void* const data_ref, size_t bytes);
  */
 void*   Buffer_write_into_buffer    (const Buffer& buffer, size_t bytes);
 
+/**
+ * @brief Copy data onto the end of a buffer, safe for concurrent writers and readers.
+ * 
+ * The data is copied into the buffer before the new size is published, so a
+ * concurrent snapshot (see Buffer_get_snapshot) never includes partially written
+ * bytes. Appends from several threads are serialized; each append is contiguous.
+ * A strong buffer is expanded if there is insufficient space.
+ * 
+ * @param buffer Iris::Buffer handle
+ * @param data pointer to raw bytes to be copied into the buffer
+ * @param bytes number of bytes to copy
+ * @return IRIS_SUCCESS on successful appending of data
+ * @return IRIS_FAILURE if the buffer is weak and lacks space, or is REFERENCE_MAPPED
+ */
+Result  Buffer_append               (const Buffer& buffer, const void* data, size_t bytes);
+
+/**
+ * @brief Take a consistent snapshot of a buffer's committed bytes for reading.
+ * 
+ * This is safe to call from any thread while another thread writes into the buffer.
+ * The snapshot's data pointer and size remain valid for as long as the snapshot
+ * persists, even if the writer expands (and relocates) the buffer meanwhile.
+ * 
+ * @param buffer Iris::Buffer handle
+ * @return BufferSnapshot of the buffer; an empty snapshot if the buffer is invalid
+ */
+BufferSnapshot Buffer_get_snapshot  (const Buffer& buffer);
+
 /**
  * @brief Copy-extract the data from the underlying buffer structure. 
  * 
  * This is useful if you don't want to include the IrisCodecBuffer.h header and 
  * expose yourself to accidentally using it incorrectly and corrupting your memory.
+ * To share a sub-range of a buffer without copying, use Buffer_slice instead.
  * 
  * @param buffer Iris::Buffer handle
  * @param data data pointer to copy the data into. If a null-ptr, only the @ref size will be returned.
  * @param bytes number of bytes copied out of the buffer handle
  */
 void    Buffer_get_data             (const Buffer& buffer, void*& data, size_t& bytes);
+/**
+ * @brief Create an empty buffer chain that grows in segments of @ref segment_size_in_bytes.
+ * 
+ * Use a buffer chain rather than a strong buffer to assemble large outputs of unknown
+ * final size, such as exported regions or encoded annotation payloads. Appending to a
+ * chain adds segments instead of reallocating and copying one contiguous data block.
+ * 
+ * @param segment_size_in_bytes capacity (in bytes) of each segment added to the chain
+ * @return Valid Iris::BufferChain handle with size 0 bytes on success
+ * @return Nullptr on failure
+ */
+BufferChain Create_buffer_chain     (size_t segment_size_in_bytes);
+
+/**
+ * @brief Write data into a buffer chain. 
+ * 
+ * This works as Buffer_write_into_buffer but never relocates previously written
+ * data. The returned region is contiguous; if it does not fit within the last
+ * segment, a new segment is started.
+ * 
+ * @param chain Iris::BufferChain handle
+ * @param bytes number of bytes to prepare for writing; size of the chain will be expanded by this number of bytes
+ * @return void* c-style data pointer to start writable memory
+ * @return NULL-pointer in the event of failure.
+ */
+void*   Buffer_chain_write_into     (const BufferChain& chain, size_t bytes);
+
+/**
+ * @brief Copy data onto the end of a buffer chain, spanning segments as needed.
+ * 
+ * @param chain Iris::BufferChain handle
+ * @param data pointer to raw bytes to be copied into the chain
+ * @param bytes number of bytes to copy
+ * @return IRIS_SUCCESS on successful appending of data
+ */
+Result  Buffer_chain_append         (const BufferChain& chain, const void* data, size_t bytes);
+
+/**
+ * @brief Get iovec-style views of each segment in a buffer chain.
+ * 
+ * The views are suitable for scatter-gather writes (such as writev or
+ * vectored socket sends) without flattening the chain.
+ * 
+ * @param chain Iris::BufferChain handle
+ * @return BufferSegments ordered list of segment data pointers and sizes
+ */
+BufferSegments Buffer_chain_get_segments (const BufferChain& chain);
+
+/**
+ * @brief Flatten a buffer chain into a single contiguous buffer.
+ * 
+ * Only call this when a contiguous view is actually required. A chain with a
+ * single segment is returned as a zero-copy slice of that segment; otherwise
+ * the segments are copied into a new strong buffer.
+ * 
+ * @param chain Iris::BufferChain handle
+ * @return Valid Iris::Buffer handle with the chain's size on success
+ * @return Nullptr on failure
+ */
+Buffer  Buffer_chain_flatten        (const BufferChain& chain);
+
+/**
+ * @brief Configure the process-wide buffer pool used by strong buffers.
+ * 
+ * Create_strong_buffer, Copy_strong_buffer_from_data, and any resizing of a strong
+ * buffer draw their data blocks from this pool. Calling this releases currently
+ * retained free blocks that no longer fit the new limits; outstanding buffers are unaffected.
+ * 
+ * @param info pool limits
+ * @return IRIS_SUCCESS on successful configuration
+ */
+Result  Buffer_pool_configure       (const BufferPoolInfo& info) noexcept;
+/**
+ * @brief Get a snapshot of the buffer pool hit and miss counters.
+ * 
+ * @return BufferPoolStatistics counters accumulated since process start
+ */
+BufferPoolStatistics Buffer_pool_get_statistics () noexcept;
 /**
  * @brief Change the strength of an Iris Buffer.
  * 
+ * \note Buffers whose data block was allocated by Iris (Create_strong_buffer,
+ * Copy_strong_buffer_from_data, Create_aligned_strong_buffer, or any expansion of
+ * a strong buffer) cannot be weakened, as pooled and aligned blocks cannot be
+ * released by the program with free().
+ * \note A weak buffer cannot be strengthened while any slice of it (see Buffer_slice)
+ * persists, as a later expansion or destruction of the then strong buffer would free
+ * memory the slices still reference.
+ * 
  * @param buffer handle to the buffer object. Must be a valid buffer.
  * @param strength strength to assign the buffer
  * \sa BufferReferenceStrength for more details
+ * @return IRIS_SUCCESS on successfully changing the strength
+ * @return IRIS_FAILURE if the data block cannot change ownership; the strength is unchanged
  */
-void    Buffer_change_strength      (const Buffer& buffer, BufferReferenceStrength strength);
+Result  Buffer_change_strength      (const Buffer& buffer, BufferReferenceStrength strength);
 }
 
 #endif /* IrisCore_h */
@@ -22,6 +22,7 @@ enum ResultFlag : uint32_t {
     IRIS_SUCCESS        = 0,
     IRIS_FAILURE        = 0x00000001,
     IRIS_UNINITIALIZED  = 0x00000002,
+    IRIS_CANCELLED      = 0x00000004,
     RESULT_MAX_ENUM     = 0xFFFFFFFF,
 };
 /**
@@ -51,9 +52,15 @@ struct Result {
  * 
  * \note A weak buffer explicitly is forbidden from resizing the buffer as it *may*
  * invalidate the original pointer.
+ * \note A mapped buffer's data is a read-only memory mapping of a file range.
+ * The pages are backed by the operating system's page cache rather than process
+ * heap memory and may be evicted under memory pressure and re-read on access.
  * \warning Changing a strong to weak buffer **requires** the calling program
  * take responsibility for the buffer data pointer. It is now that program's
- * responsibility to free that data once finished or a memory leak will ensue.
+ * responsibility to free that data (with free()) once finished or a memory leak will ensue.
+ * This is only permitted for data blocks the program allocated itself and gave to a
+ * buffer by strengthening a weak buffer. Data blocks that Iris allocated (from the
+ * buffer pool or with an alignment) cannot be released to the program.
  * 
  */
 enum BufferReferenceStrength {
@@ -61,6 +68,26 @@ enum BufferReferenceStrength {
     REFERENCE_WEAK      = 0,
     /// @brief Full ownership. Will free data on buffer destruction. Can resize underlying pointer.
     REFERENCE_STRONG    = 1,
+    /// @brief Owns a read-only file mapping. Will unmap on buffer destruction. Cannot resize or write.
+    REFERENCE_MAPPED    = 2,
+};
+/**
+ * @brief Minimum alignment of a strong buffer's data block.
+ * 
+ * The alignment is assigned at creation and is preserved whenever the data block
+ * is reallocated (prepare, append, resize, and shrink_to_fit), so aligned buffers
+ * can always be fed directly to vectorized kernels or DMA-style uploads.
+ * Any other power of two may be cast to this type.
+ */
+enum BufferAlignment : size_t {
+    /// @brief Allocator default alignment (alignof(std::max_align_t))
+    BUFFER_ALIGNMENT_DEFAULT    = 0,
+    /// @brief 32-byte alignment for AVX / AVX2 aligned loads and stores
+    BUFFER_ALIGNMENT_SIMD       = 32,
+    /// @brief 64-byte cache line alignment (also satisfies AVX-512)
+    BUFFER_ALIGNMENT_CACHE_LINE = 64,
+    /// @brief Alignment to the operating system's virtual memory page size
+    BUFFER_ALIGNMENT_PAGE       = SIZE_MAX,
 };
 /**
  * @brief Reference counted data object used to wrap datablocks.
@@ -75,10 +102,87 @@ enum BufferReferenceStrength {
  *  as they were created for exclusive use by Iris developers and use of these methods
  *  comes with risk.
  *
- *  \warning Buffer is currently NOT safe for concurrent use on muplitple threads.
- *  This will be fixed in future updates.
+ *  \note Buffer follows single-writer / multi-reader semantics. Appends made with
+ *  Buffer_append from several threads are serialized, and any number of threads may
+ *  read the buffer meanwhile through snapshots (see Buffer_get_snapshot). A snapshot
+ *  keeps its data block alive even if the buffer is relocated by a write.
+ *  Buffer_write_into_buffer is single-writer only and is not safe alongside
+ *  snapshot readers, as it counts the reserved bytes before they are written.
  */
 using Buffer = std::shared_ptr<class __INTERNAL__Buffer>;
+/**
+ * @brief Consistent read-only view of a buffer's committed bytes at one point in time.
+ * 
+ * The snapshot holds a reference to the buffer's data block. The block is not freed
+ * or recycled while any snapshot of it persists, even if the buffer has since been
+ * expanded into a new block, so data and size remain valid for the snapshot's lifetime.
+ */
+struct BufferSnapshot {
+    /// @brief Reference keeping the data block alive
+    std::shared_ptr<const void> block;
+    /// @brief Start of the buffer's data within the pinned block
+    const void*         data        = nullptr;
+    /// @brief Committed size in bytes at the time of the snapshot
+    size_t              size        = 0;
+};
+/**
+ * @brief Reference counted chain of fixed-size buffer segments.
+ * 
+ * A buffer chain grows by adding segments rather than by reallocating and
+ * copying a single contiguous block, so appending never relocates previously
+ * written data. The chain is read as a list of segments (similar to a POSIX iovec
+ * array) and only flattened into a contiguous Buffer when one is actually required.
+ * 
+ * \note __INTERNAL__BufferChain is an internally defined class declared
+ * alongside __INTERNAL__Buffer.
+ */
+using BufferChain = std::shared_ptr<class __INTERNAL__BufferChain>;
+/**
+ * @brief Read-only view of one segment of a BufferChain (iovec-style).
+ */
+struct BufferSegment {
+    /// @brief Start of the written bytes within the segment
+    const void*         data        = nullptr;
+    /// @brief Number of written bytes within the segment
+    size_t              size        = 0;
+};
+using BufferSegments = std::vector<BufferSegment>;
+/**
+ * @brief Configuration of the process-wide buffer pool backing strong buffers.
+ * 
+ * Strong buffer data blocks are drawn from power-of-two size classes. Each thread
+ * keeps a small cache of freed blocks per size class and returns surplus blocks
+ * to a shared depot, so repeatedly creating and freeing tile sized buffers
+ * (a 256x256 RGBA tile is 256 KiB) does not return to the system allocator.
+ * Requests larger than the largest size class bypass the pool.
+ */
+struct BufferPoolInfo {
+    /// @brief Largest data block (in bytes) served by the pool; larger blocks use the system allocator
+    size_t              maxBlockSize        = 4 * 1024 * 1024;
+    /// @brief Number of free blocks per size class each thread may cache before returning them to the depot
+    uint32_t            threadCacheBlocks   = 8;
+    /// @brief Total bytes of free blocks the shared depot may retain before releasing them to the system
+    size_t              depotBytes          = 256 * 1024 * 1024;
+};
+/**
+ * @brief Snapshot of the process-wide buffer pool counters.
+ * 
+ * A hit is an allocation served from a thread cache or the depot; a miss
+ * required a fresh allocation from the system. Use these to size the
+ * BufferPoolInfo limits for a given workload.
+ */
+struct BufferPoolStatistics {
+    /// @brief Allocations served from a per-thread cache
+    uint64_t            threadCacheHits = 0;
+    /// @brief Allocations served from the shared depot
+    uint64_t            depotHits       = 0;
+    /// @brief Allocations that required the system allocator
+    uint64_t            misses          = 0;
+    /// @brief Allocations larger than BufferPoolInfo::maxBlockSize
+    uint64_t            oversized       = 0;
+    /// @brief Bytes currently held free within the depot and all thread caches
+    size_t              retainedBytes   = 0;
+};
 /**
  * @brief Access point to Iris API and controls all elements of Iris viewspace
  * 
@@ -127,6 +231,10 @@ struct ViewerCreateInfo {
  * and thus define the nature of the OS draw surface handles.
  *  - Windows: requires HINSTANCE and HWND handles from the WIN32 API
  *  - Apple: macOS and iOS require a __bridge pointer to a CAMetalLayer
+ *  - Linux: binds an offscreen render target of the given pixel extent. No
+ *    window system or display is required, and the engine may run on a CPU
+ *    Vulkan implementation (such as lavapipe) on systems without a GPU.
+ *    Resize the target with viewer_window_will_resize.
  * 
  */
 struct ViewerBindExternalSurfaceInfo {
@@ -136,6 +244,13 @@ struct ViewerBindExternalSurfaceInfo {
     HWND                window      = NULL;    
 #elif defined __APPLE__
     const void*         layer       = nullptr; 
+#elif defined __linux__
+    /// @brief Offscreen render target width in pixels
+    uint32_t            width       = 0;
+    /// @brief Offscreen render target height in pixels
+    uint32_t            height      = 0;
+    /// @brief Prefer a CPU (software) Vulkan device even if a GPU is available
+    bool                preferCPU   = false;
 #endif
 };
 
@@ -152,17 +267,97 @@ struct ViewerResizeSurfaceInfo {
  * An x translation value of 0.5 will shift the view to the right by half of the current
  * view sapce while -1.0 will shift the scope view to the left by an entire screen.
  * 
+ * The velocities are used by the engine to prefetch tiles ahead of the view in the
+ * direction of travel (see ViewerPrefetchInfo). Provide them whenever the translation
+ * results from continuous user input such as a drag or fling. They are measured in
+ * fractions of the view space per second and have the same sign as x_translate and
+ * y_translate respectively: a drag producing x_translate > 0 at half a screen per
+ * second reports x_velocity = 0.5. Leave them at 0 if the speed is unknown.
+ * 
  */
 struct ViewerTranslateScope {
     /// @brief Fraction of *horizontal* viewspace to translate [-1,1](-left, +right)
     float               x_translate = 0.f;
-    /// @brief Fraction of *vertical* viewspace to translate [-1,1](-left, +right)
+    /// @brief Fraction of *vertical* viewspace to translate [-1,1](-up, +down)
     float               y_translate = 0.f;
-    /// @brief Horizontal translation velocity (suggested [0,2])
+    /// @brief Horizontal velocity in viewspace fractions per second (same sign as x_translate)
     float               x_velocity  = 0.f;
-    /// @brief Velocity of translation (suggested [0,2]) in the horizontal
+    /// @brief Vertical velocity in viewspace fractions per second (same sign as y_translate)
     float               y_velocity  = 0.f;
 };
+/**
+ * @brief Priority of a tile read within a slide's asynchronous read scheduler.
+ * 
+ * Slide read threads always service the highest priority pending request first;
+ * requests of equal priority are serviced nearest to the view center first.
+ * Lower values are higher priorities. The viewer assigns these to its own reads;
+ * direct slide reads (slide_read_tile and its variants) take one as an optional
+ * argument, so background work such as analysis can be queued at
+ * TILE_READ_PRIORITY_PREFETCH without delaying a viewer's visible tiles.
+ */
+enum TileReadPriority : uint8_t {
+    /// @brief Tiles on screen at the current layer
+    TILE_READ_PRIORITY_VISIBLE,
+    /// @brief Lower-resolution placeholder tiles drawn while visible tiles load
+    TILE_READ_PRIORITY_PLACEHOLDER,
+    /// @brief Predicted tiles not yet on screen (see ViewerPrefetchInfo)
+    TILE_READ_PRIORITY_PREFETCH,
+};
+/**
+ * @brief Shared cancellation flag attached to slide read requests.
+ * 
+ * Every read on a slide's internal read path carries a token. Storing true
+ * into the token drops the request: a queued request is discarded before
+ * it starts and an in-flight request is abandoned at its next stage boundary
+ * (between the read and the decode) without inserting into the cache. The
+ * engine cancels its own tokens for tiles it no longer needs, for example
+ * positions passed through during a fling. Create one with
+ * std::make_shared<std::atomic_bool>(false) to cancel your own reads.
+ */
+using CancelToken = std::shared_ptr<std::atomic_bool>;
+/**
+ * @brief Counters of a slide's read requests by outcome.
+ * 
+ * Counters accumulate from slide creation. Requests still queued
+ * or in flight are the difference between requested and the remaining counters.
+ */
+struct SlideReadStatistics {
+    /// @brief Read requests submitted to the slide's read threads
+    uint64_t            requested       = 0;
+    /// @brief Reads that completed and delivered a tile
+    uint64_t            completed       = 0;
+    /// @brief Reads cancelled while still queued (no I/O performed)
+    uint64_t            cancelledQueued   = 0;
+    /// @brief Reads cancelled after starting (I/O or decode abandoned)
+    uint64_t            cancelledInFlight = 0;
+    /// @brief Reads that failed
+    uint64_t            failed          = 0;
+};
+/**
+ * @brief Information to configure predictive tile prefetching for a viewer.
+ * 
+ * During continuous translation, the engine extrapolates the view along the
+ * ViewerTranslateScope velocity vector and requests tiles entering that predicted
+ * region ahead of time (TILE_READ_PRIORITY_PREFETCH), nearest to the current view
+ * first. While zooming, the engine also requests the region surrounding the
+ * ViewerZoomScope origin on the next layer in the zoom direction (LayerExtents)
+ * before the scale crosses over to it, so the layer switch is seamless. Prefetch
+ * requests are always scheduled below tiles currently on screen and are limited
+ * by a budget so they never starve the visible view.
+ */
+struct ViewerPrefetchInfo {
+    const Viewer        viewer          = nullptr;
+    /// @brief Prefetch tiles ahead of the view in the direction of travel
+    bool                velocityPrefetch = true;
+    /// @brief Time (in seconds) of travel at the current velocity to prefetch ahead
+    float               lookahead       = 0.25f;
+    /// @brief Maximum number of prefetch tiles outstanding at any time
+    uint32_t            maxPrefetchTiles = 64;
+    /// @brief Prefetch the next layer in the zoom direction during zooming
+    bool                zoomPrefetch    = true;
+    /// @brief Radius (in tiles of the next layer) around the zoom origin to prefetch
+    uint32_t            zoomPrefetchRadius = 2;
+};
 /**
  * @brief Information to change the zoom objective.
  * 
@@ -171,6 +366,8 @@ struct ViewerTranslateScope {
  * The zoom origin (x_location and y_location) defines the region
  * around which to zoom. This is best set as either the cursor location
  * or view center (0.5, 0.5).
+ * The zoom origin is also used to prefetch the next layer in the zoom
+ * direction (see ViewerPrefetchInfo).
  * 
  */
 struct ViewerZoomScope {
@@ -236,6 +433,19 @@ struct LayerExtent {
     float               downsample  = 1.f;
 };
 using LayerExtents = std::vector<LayerExtent>;
+/**
+ * @brief Tile index within a slide layer.
+ */
+struct TileCoordinates {
+    /// @brief Horizontal tile index [0, LayerExtent::xTiles)
+    uint32_t            x           = 0;
+    /// @brief Vertical tile index [0, LayerExtent::yTiles)
+    uint32_t            y           = 0;
+};
+/**
+ * @brief Ordered list of tile indices within a single layer.
+ */
+using TileCoordinatesList = std::vector<TileCoordinates>;
 /**
  * @brief The extent, in pixels, of a whole side image file. 
  * 
@@ -267,11 +477,49 @@ enum Format {
     /// @brief 8-bit red, 8-bit green, 8-bit blue, 8-bit alpha
     FORMAT_R8G8B8A8,
 };
+/**
+ * @brief Resampling filter used when a region is read at a downsample between layers.
+ */
+enum ResampleFilter : uint8_t {
+    /// @brief Box / area averaging. Fastest; well suited to integer-like downsample ratios.
+    RESAMPLE_FILTER_AREA,
+    /// @brief Lanczos (a = 3) windowed sinc. Sharper at the cost of more computation.
+    RESAMPLE_FILTER_LANCZOS3,
+};
+/**
+ * @brief Information to read an arbitrary region of a slide at an arbitrary downsample.
+ * 
+ * The region is given in pixels of the highest resolution layer (the layer with
+ * a LayerExtent::downsample of 1). The output is width / downsample by
+ * height / downsample pixels (rounded up). The region is read from the nearest
+ * layer at least as fine as the target downsample and resampled to it; if the
+ * target matches a layer's downsample, the pixels are copied without resampling.
+ */
+struct SlideRegionReadInfo {
+    /// @brief Left edge of the region in highest resolution layer pixels
+    uint32_t            x           = 0;
+    /// @brief Top edge of the region in highest resolution layer pixels
+    uint32_t            y           = 0;
+    /// @brief Width of the region in highest resolution layer pixels
+    uint32_t            width       = 0;
+    /// @brief Height of the region in highest resolution layer pixels
+    uint32_t            height      = 0;
+    /// @brief Target downsample relative to the highest resolution layer (>= 1)
+    float               downsample  = 1.f;
+    /// @brief Pixel format of the output region
+    Format              format      = FORMAT_R8G8B8A8;
+    /// @brief Filter used if the target downsample does not match a layer
+    ResampleFilter      filter      = RESAMPLE_FILTER_AREA;
+};
 /**
  * @brief Information to open a slide file located on a local volume.
  * 
  * Provide the file location and the 
  * 
+ * \note Iris codec files (SLIDE_TYPE_IRIS) are memory mapped. Compressed tile
+ * bytes are passed to the decoder as REFERENCE_MAPPED buffers directly from
+ * the page cache without an intermediate read() copy.
+ * 
  */
 struct LocalSlideOpenInfo {
     const char*         filePath;
@@ -300,6 +548,21 @@ struct LocalSlideOpenInfo {
 struct NetworkSlideOpenInfo {
     const char*         slideID;
 };
+/**
+ * @brief Eviction policy of a slide tile cache.
+ * 
+ * Plain LRU is flushed by a fast zoom sweep through intermediate layers whose tiles
+ * are used once and never revisited. The scan-resistant policies keep tiles that have
+ * been requested more than once protected from such one-time sequences.
+ */
+enum SlideCachePolicy : uint8_t {
+    /// @brief Least recently used. Lowest overhead; not scan resistant.
+    SLIDE_CACHE_POLICY_LRU,
+    /// @brief 2Q: new tiles enter a probationary FIFO and are promoted to the main LRU on re-use.
+    SLIDE_CACHE_POLICY_2Q,
+    /// @brief Adaptive replacement cache: self-tunes the balance between recency and frequency.
+    SLIDE_CACHE_POLICY_ARC,
+};
 /**
  * @brief Parameters required to create an Iris::Slide WSI file handle.
  * 
@@ -345,11 +608,295 @@ struct SlideOpenInfo {
      * for greater performance. Less require more pulls from
      * disk (which is slower)
      * The default 1000 for RGBA images consumes 2 GB of RAM.
+     * \note This is ignored if a byte budget is assigned. \sa capacityBytes
      */
     size_t               capacity       = 1000;
+    /**
+     * @brief Optional slide cache budget in bytes
+     *
+     * If non-zero, the slide cache is bounded by the actual decoded size
+     * of its entries rather than by the tile count in capacity. This
+     * accounts for mixed RGB / RGBA formats and partially empty edge tiles
+     * and should be preferred to hold a fixed memory envelope per process.
+     * Tiles are evicted until the cached bytes fit within the budget.
+     */
+    size_t               capacityBytes  = 0;
+    /**
+     * @brief Slide tile cache scope
+     *
+     * A private cache belongs to this slide alone and is bounded by
+     * capacity or capacityBytes. A shared slide instead draws from the
+     * process-wide tile cache (see Iris::configure_shared_tile_cache),
+     * so multiple Slide objects or viewers showing the same slide
+     * share decoded tiles within a single process-wide budget.
+     * capacity and capacityBytes are ignored for shared slides.
+     */
+    enum : uint8_t {
+        SLIDE_CACHE_PRIVATE,            // Per-slide cache (default)
+        SLIDE_CACHE_SHARED,             // Process-wide reference counted cache
+    }                    cacheScope     = SLIDE_CACHE_PRIVATE;
+    /**
+     * @brief Private slide cache eviction policy
+     *
+     * Select a scan-resistant policy if users frequently sweep
+     * through zoom levels. Ignored for shared slides; the shared
+     * cache policy is set by SharedTileCacheInfo::policy.
+     */
+    SlideCachePolicy     cachePolicy    = SLIDE_CACHE_POLICY_LRU;
+    /**
+     * @brief Optional compressed tile cache tier budget in bytes
+     *
+     * If non-zero, a second cache tier retains the compressed (JPEG / AVIF)
+     * tile bytes already read from disk or the network. Tiles evicted from
+     * the decoded tier can be restored with a decode but without I/O.
+     * Compressed tiles are 4-8x smaller than decoded tiles so this tier
+     * can cover a much larger region of the slide for the same memory.
+     * \note This is of greatest benefit to network and OpenSlide slides.
+     * Compressed tiles of local Iris codec slides are mapped from the page
+     * cache already and are not duplicated in this tier.
+     */
+    size_t               compressedCapacityBytes = 0;
+};
+/**
+ * @brief Configuration of the process-wide tile cache shared by slides opened
+ * with SlideOpenInfo::SLIDE_CACHE_SHARED.
+ * 
+ * Entries are keyed by (slide identity, layer, x tile, y tile). The slide identity
+ * is the slide ID embedded in Iris codec files, the network slide ID for server-hosted
+ * slides, or otherwise the canonical file path together with the file's size and
+ * modification time, so a file replaced at the same path is treated as a new slide.
+ * The same slide opened by two viewers therefore maps to the same entries. Tiles are
+ * reference counted and are never evicted while a viewer is drawing them.
+ * 
+ * Eviction is fair between slides: when the budget is exceeded, tiles are evicted first
+ * from slides holding more than an equal share of the budget, least recently used first.
+ */
+struct SharedTileCacheInfo {
+    /// @brief Process-wide budget in decoded bytes for all shared slides
+    size_t              capacityBytes   = 2048ULL * 1024 * 1024;
+    /// @brief Eviction policy applied within the shared cache
+    SlideCachePolicy    policy          = SLIDE_CACHE_POLICY_LRU;
+    /// @brief Process-wide budget for the compressed tier of shared slides (0 disables the tier)
+    size_t              compressedCapacityBytes = 0;
+};
+/**
+ * @brief Configuration of the optional persistent on-disk tile cache.
+ * 
+ * The disk cache retains compressed tile bytes across process restarts so reopening
+ * a slide does not repeat network or source-file reads. Entries are keyed by slide
+ * identity and tile coordinate (layer, x, y) within the cache directory and are
+ * consulted by the slide loader before any network or source-file read. It applies
+ * to network and OpenSlide slides; local Iris codec slides are read directly from
+ * their mapped file.
+ * 
+ * The slide identity of a network slide is its network slide ID. A slide identified
+ * by its file path (such as an OpenSlide slide) is identified by its canonical path,
+ * file size, and modification time, so replacing or rewriting the file at that path
+ * never serves tiles cached from the previous file. Entries of the replaced file are
+ * no longer referenced and are removed by eviction sweeps.
+ * 
+ * Writes are crash-safe: each entry is written to a temporary file and atomically
+ * renamed into place, and entries are checksummed so a torn or corrupt entry is
+ * discarded and re-read from the source. When the directory exceeds its budget,
+ * an eviction sweep removes the least recently accessed entries.
+ * 
+ * \note Multiple processes may share one cache directory.
+ */
+struct DiskTileCacheInfo {
+    /// @brief Cache directory. It is created if it does not exist. A null-pointer disables the disk cache.
+    const char*         directory       = nullptr;
+    /// @brief Maximum bytes the cache directory may occupy
+    uint64_t            capacityBytes   = 16ULL * 1024 * 1024 * 1024;
+};
+/**
+ * @brief Occupancy and counters of a single tile cache tier.
+ */
+struct SlideCacheTierStatistics {
+    /// @brief Number of tiles currently cached in this tier
+    size_t              entries         = 0;
+    /// @brief Bytes currently held by tiles in this tier
+    uint64_t            bytes           = 0;
+    /// @brief Byte budget of this tier; 0 if the tier is bounded by tile count or disabled
+    uint64_t            budgetBytes     = 0;
+    /// @brief Tile requests served from this tier
+    uint64_t            hits            = 0;
+    /// @brief Tile requests that fell through this tier
+    uint64_t            misses          = 0;
+    /// @brief Tiles evicted from this tier to remain within its budget
+    uint64_t            evictions       = 0;
+};
+/**
+ * @brief Snapshot of a slide tile cache's current occupancy and counters.
+ * 
+ * The decoded tier holds decoded tiles, measured by their real decoded size.
+ * The compressed tier holds encoded tile bytes; a decoded tier miss that hits
+ * the compressed tier costs a decode but no I/O. The disk tier is the process' view
+ * of the persistent disk cache, if configured. Hit, miss, and eviction counters
+ * accumulate from the creation of the cache and can be used to compare eviction
+ * policies on recorded sessions.
+ */
+struct SlideCacheStatistics {
+    /// @brief Tile count capacity of the decoded tier (SlideOpenInfo::capacity)
+    size_t              capacity        = 0;
+    /// @brief Eviction policy in use
+    SlideCachePolicy    policy          = SLIDE_CACHE_POLICY_LRU;
+    /// @brief Decoded tile tier (SlideOpenInfo::capacityBytes budget)
+    SlideCacheTierStatistics decoded;
+    /// @brief Compressed tile tier (SlideOpenInfo::compressedCapacityBytes budget)
+    SlideCacheTierStatistics compressed;
+    /// @brief Persistent on-disk tier (DiskTileCacheInfo::capacityBytes budget)
+    SlideCacheTierStatistics disk;
+};
+/**
+ * @brief Pipeline timestamps and tile counts of a single composed frame.
+ * 
+ * Timestamps are in microseconds of std::chrono::steady_clock (time since its epoch)
+ * so they can be correlated with the calling application's own steady clock.
+ * A timestamp is 0 if the frame did not pass through that stage; for example
+ * inputReceived is 0 for frames not caused by a translate or zoom call, and the
+ * tile stages are 0 if every visible tile was already cached. The stage durations
+ * locate the cause of a late frame: I/O and decode (tilesRequested to tilesReady),
+ * upload and composition (tilesReady to drawSubmitted), and presentation.
+ */
+struct FrameStatistics {
+    /// @brief Monotonic frame index since the surface was bound
+    uint64_t            frame           = 0;
+    /// @brief First translate / zoom call affecting this frame was received
+    uint64_t            inputReceived   = 0;
+    /// @brief Visible tiles missing from the cache were requested from the slide
+    uint64_t            tilesRequested  = 0;
+    /// @brief The last requested tile was decoded and ready to upload
+    uint64_t            tilesReady      = 0;
+    /// @brief Draw commands for the frame were submitted to the GPU
+    uint64_t            drawSubmitted   = 0;
+    /// @brief The frame was presented (or written to the offscreen target)
+    uint64_t            presented       = 0;
+    /// @brief Tiles drawn at the current layer
+    uint32_t            tilesDrawn      = 0;
+    /// @brief Tiles drawn with a lower-layer placeholder because the current layer tile was not ready
+    uint32_t            placeholderTiles = 0;
+};
+/**
+ * @brief Recent frames of a viewer, oldest first.
+ */
+using FrameStatisticsList = std::vector<FrameStatistics>;
+/**
+ * @brief Description of a frame read back with Iris::viewer_read_frame.
+ * 
+ * The extent is that of the surface when the frame was composed, which may
+ * differ from the current surface extent if it was resized since.
+ * The frame index and presentation time match the frame's FrameStatistics.
+ */
+struct FrameReadInfo {
+    /// @brief Frame width in pixels
+    uint32_t            width           = 0;
+    /// @brief Frame height in pixels
+    uint32_t            height          = 0;
+    /// @brief Monotonic frame index since the surface was bound (FrameStatistics::frame)
+    uint64_t            frame           = 0;
+    /// @brief Time the frame was presented (FrameStatistics::presented)
+    uint64_t            presented       = 0;
+};
+/**
+ * @brief Information to replay a recorded viewer session.
+ * 
+ * A recording (see Iris::viewer_begin_recording) holds the timestamped sequence of
+ * slide open / close, resize, translate, and zoom calls made on a viewer. Replaying
+ * it issues the same calls on the given viewer at the same times relative to the
+ * start of the session, so the engine experiences the same input as the user's session.
+ * 
+ * Slides are opened with the cache settings recorded in the session unless
+ * overrideCache is set, in which case the cache settings below replace them for
+ * every slide the replay opens. This allows the same recording to be replayed
+ * under different eviction policies and budgets to compare their hit rates.
+ */
+struct ViewerReplayInfo {
+    const Viewer        viewer          = nullptr;
+    /// @brief Path of the recording file to replay
+    const char*         recordingPath   = nullptr;
+    /// @brief Optional slide file path replacing the slide(s) opened in the recording
+    const char*         slidePath       = nullptr;
+    /// @brief Replay on the recorded wall-clock schedule (true), or step one call per composed frame (false)
+    bool                realtime        = true;
+    /// @brief Replace the recorded slide cache settings with those below
+    bool                overrideCache   = false;
+    /// @brief Decoded tier tile count capacity (see SlideOpenInfo::capacity)
+    size_t              capacity        = 1000;
+    /// @brief Decoded tier byte budget; 0 bounds by capacity (see SlideOpenInfo::capacityBytes)
+    size_t              capacityBytes   = 0;
+    /// @brief Private cache eviction policy (see SlideOpenInfo::cachePolicy)
+    SlideCachePolicy    cachePolicy     = SLIDE_CACHE_POLICY_LRU;
+    /// @brief Compressed tier byte budget; 0 disables it (see SlideOpenInfo::compressedCapacityBytes)
+    size_t              compressedCapacityBytes = 0;
+};
+/**
+ * @brief Measurements of a replayed viewer session.
+ * 
+ * Frame latency is measured from the first input affecting a frame to its
+ * presentation. A missed tile is a visible tile drawn with a lower-resolution
+ * placeholder (or blank) because it was not yet decoded when the frame was composed.
+ */
+struct ViewerReplayReport {
+    /// @brief Number of frames composed during the replay
+    uint32_t            frames          = 0;
+    /// @brief Median frame latency in milliseconds
+    float               latencyP50      = 0.f;
+    /// @brief 90th percentile frame latency in milliseconds
+    float               latencyP90      = 0.f;
+    /// @brief 99th percentile frame latency in milliseconds
+    float               latencyP99      = 0.f;
+    /// @brief Maximum frame latency in milliseconds
+    float               latencyMax      = 0.f;
+    /// @brief Visible tiles not available when their frame was composed, summed over all frames
+    uint64_t            tilesMissed     = 0;
+    /// @brief Frames in which at least one visible tile was missed
+    uint32_t            framesMissed    = 0;
+    /// @brief Tile cache counters accumulated over the replay
+    SlideCacheStatistics cache;
+};
+/**
+ * @brief Categories of engine activity recorded while tracing.
+ * 
+ * Combine flags with bitwise OR to select the recorded categories.
+ */
+enum EngineTraceCategory : uint32_t {
+    /// @brief Slide tile reads from disk, the network, or the disk cache
+    TRACE_CATEGORY_TILE_READ    = 0x00000001,
+    /// @brief Tile decode
+    TRACE_CATEGORY_DECODE       = 0x00000002,
+    /// @brief Tile cache inserts and evictions (all tiers)
+    TRACE_CATEGORY_CACHE        = 0x00000004,
+    /// @brief Buffer allocations, pool hits and misses, and mappings
+    TRACE_CATEGORY_BUFFER       = 0x00000008,
+    /// @brief Frame stages (see FrameStatistics)
+    TRACE_CATEGORY_FRAME        = 0x00000010,
+    /// @brief All categories
+    TRACE_CATEGORY_ALL          = 0xFFFFFFFF,
+};
+/**
+ * @brief Information to begin recording an engine trace.
+ * 
+ * Every Iris thread records spans into its own preallocated event buffer;
+ * no locks are taken and nothing is allocated while recording. Once a thread's
+ * buffer is full, its oldest events are overwritten.
+ */
+struct EngineTraceInfo {
+    /// @brief Bitwise OR of EngineTraceCategory flags to record
+    uint32_t            categories      = TRACE_CATEGORY_ALL;
+    /// @brief Maximum events retained per thread
+    uint32_t            threadEventCapacity = 65536;
 };
 using LambdaPtr         = std::function<void()>;
 using LambdaPtrs        = std::vector<LambdaPtr>;
+/**
+ * @brief Completion callback of an asynchronous slide read.
+ * 
+ * Invoked exactly once on an Iris read thread with IRIS_SUCCESS and the read buffer,
+ * IRIS_CANCELLED and a nullptr if the read's CancelToken was set, or IRIS_FAILURE
+ * and a nullptr on failure. Callbacks must not block; hand the buffer to your own
+ * event loop or executor for any further work.
+ */
+using SlideReadCallback = std::function<void(const Result&, const Buffer&)>;
 } // END IRIS NAMESPACE
 
 #endif /* IrisTypes_h */
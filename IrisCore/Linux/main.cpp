@@ -0,0 +1,171 @@
+/**
+ * @file main.cpp
+ * @author Ryan Landvater
+ * @brief Entry Point for Iris Linux Headless Example Implementation
+ * @version 2024.0.1
+ * @date 2024-11-04
+ *
+ * @copyright Copyright (c) 2023-24
+ *
+ * This is an example implementation of an Iris Viewer for the Linux
+ * OS Platform. The viewer renders into an offscreen target and requires
+ * no window system, display, or GPU, making it suitable for render
+ * farms and continuous integration.
+ *
+ */
+
+// Include standard headers
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <iostream>
+#include <fstream>
+#include <filesystem>
+#include <chrono>
+#include <thread>
+
+// Include Iris Core header
+#include "IrisCore.hpp"
+
+// Offscreen render target dimensions
+#define             FRAME_WIDTH     1920
+#define             FRAME_HEIGHT    1080
+// Longest time to wait for a frame reflecting the scope view changes
+#define             FRAME_TIMEOUT_MS 5000
+
+// Current time in microseconds of the steady clock, as used by FrameStatistics
+static uint64_t get_steady_microsecond_timestamp ()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>
+           (std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// A frame is complete once it was drawn without lower-layer placeholders,
+// meaning every visible tile had been loaded.
+static bool frame_is_complete (const Iris::Viewer& viewer, uint64_t frame)
+{
+    Iris::FrameStatisticsList frames;
+    if (Iris::viewer_get_frame_statistics(viewer, frames) != Iris::IRIS_SUCCESS)
+        return false;
+    for (const auto& statistics : frames)
+        if (statistics.frame == frame) return statistics.placeholderTiles == 0;
+    return false;
+}
+
+int main (int argc, char** argv)
+{
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << " <slide file path>\n";
+        return EXIT_FAILURE;
+    }
+
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ //
+    //         Create the Iris::Viewer          //
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ //
+    // The bundle path is the directory containing this executable;
+    // Iris loads its runtime resources (shaders) from this location.
+    std::string bundle_path = std::filesystem::canonical("/proc/self/exe")
+                              .parent_path().string();
+    Iris::ViewerCreateInfo viewer_info {
+        .ApplicationName         = "Iris Headless",
+        .ApplicationVersion      = 20240101,
+        .ApplicationBundlePath   = bundle_path.c_str(),
+    };
+    Iris::Viewer viewer = Iris::create_viewer(viewer_info);
+    if (!viewer) return EXIT_FAILURE;
+
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ //
+    //  Bind the Viewer to an offscreen target  //
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ //
+    // There is no window on Linux; Iris creates its own
+    // offscreen render target of the requested extent.
+    // Prefer a CPU Vulkan device so this runs without a GPU.
+    Iris::ViewerBindExternalSurfaceInfo bind_info {
+        .viewer      = viewer,
+        .width       = FRAME_WIDTH,
+        .height      = FRAME_HEIGHT,
+        .preferCPU   = true,
+    };
+    Iris::Result result = Iris::viewer_bind_external_surface(bind_info);
+    if (result != Iris::IRIS_SUCCESS) {
+        std::cerr << "Failed to bind offscreen surface: " << result.message << "\n";
+        return EXIT_FAILURE;
+    }
+
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ //
+    //          Open the slide to view          //
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ //
+    Iris::SlideOpenInfo open_info {
+        .type = Iris::SlideOpenInfo::SLIDE_OPEN_LOCAL,
+        .local = Iris::LocalSlideOpenInfo {
+            .filePath = argv[1]
+        }
+    };
+    result = Iris::viewer_open_slide(viewer, open_info);
+    if (result != Iris::IRIS_SUCCESS) {
+        std::cerr << "Failed to open slide: " << result.message << "\n";
+        return EXIT_FAILURE;
+    }
+
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ //
+    //       Drive the scope view headless      //
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ //
+    // Without user input, the scope view is controlled with the same
+    // calls the windowed examples make from their input handlers.
+    // They are applied on the render thread, so note when they were made.
+    uint64_t input_time = get_steady_microsecond_timestamp();
+    // Zoom in towards the view center...
+    Iris::viewer_engine_zoom(viewer, Iris::ViewerZoomScope {
+        .increment  = 1.f,
+    });
+    // ...and pan one screen to the left.
+    Iris::viewer_engine_translate(viewer, Iris::ViewerTranslateScope {
+        .x_translate = -1.f,
+    });
+
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ //
+    //      Read back the composed frame        //
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ //
+    // Copy the last composed frame out of the viewer. Reuse the
+    // same buffer if streaming frames to avoid reallocation.
+    // A frame read straight away may predate the calls above or still
+    // show placeholders; poll until a complete frame presented after
+    // them is available, giving up after FRAME_TIMEOUT_MS.
+    Iris::Buffer        frame = Iris::Create_strong_buffer(FRAME_WIDTH * FRAME_HEIGHT * 3);
+    Iris::FrameReadInfo info;
+    bool                ready = false;
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(FRAME_TIMEOUT_MS);
+    while (!ready && std::chrono::steady_clock::now() < deadline) {
+        result = Iris::viewer_read_frame(viewer, Iris::FORMAT_R8G8B8, frame, info);
+        if (result == Iris::IRIS_SUCCESS)
+            ready = info.presented >= input_time && frame_is_complete(viewer, info.frame);
+        else if (result != Iris::IRIS_UNINITIALIZED) break;
+        if (!ready) std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    if (!ready) {
+        std::cerr << "Failed to read back a composed frame: "
+                  << (result.message.empty() ? "timed out" : result.message) << "\n";
+        Iris::viewer_close_slide(viewer);
+        Iris::viewer_unbind_surface(viewer);
+        return EXIT_FAILURE;
+    }
+
+    // Get the frame size, then copy the pixels out of the buffer
+    size_t bytes = 0;
+    void*  pixels = nullptr;
+    Iris::Buffer_get_data(frame, pixels, bytes);
+    std::string pixel_data (bytes, '\0');
+    pixels = pixel_data.data();
+    Iris::Buffer_get_data(frame, pixels, bytes);
+
+    // And write them into a binary PPM image for inspection,
+    // using the extent the frame was actually composed at
+    std::ofstream image ("frame.ppm", std::ios::binary);
+    image << "P6\n" << info.width << " " << info.height << "\n255\n";
+    image.write(pixel_data.data(), bytes);
+
+    // Close the slide and unbind the surface before exiting
+    Iris::viewer_close_slide(viewer);
+    Iris::viewer_unbind_surface(viewer);
+    return EXIT_SUCCESS;
+}
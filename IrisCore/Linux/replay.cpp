@@ -0,0 +1,146 @@
+/**
+ * @file replay.cpp
+ * @author Ryan Landvater
+ * @brief Headless Iris session replay tool for the Linux Example Implementation
+ * @version 2024.0.1
+ * @date 2024-11-04
+ *
+ * @copyright Copyright (c) 2023-24
+ *
+ * Replays a viewer session recorded with Iris::viewer_begin_recording
+ * (see the Windows example 'R' key) on an offscreen Linux viewer and
+ * reports frame latency percentiles, missed tiles, and cache hit rates.
+ * Run it on the same recording before and after a change to turn
+ * perceived smoothness into comparable numbers, or with --policy and
+ * --budget to compare slide cache eviction policies and budgets.
+ *
+ */
+
+// Include standard headers
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <iostream>
+#include <filesystem>
+
+// Include Iris Core header
+#include "IrisCore.hpp"
+
+// Offscreen render target dimensions
+#define             FRAME_WIDTH     1920
+#define             FRAME_HEIGHT    1080
+
+// Fraction of tile requests served by a cache tier
+static double hit_rate (const Iris::SlideCacheTierStatistics& tier)
+{
+    uint64_t requests = tier.hits + tier.misses;
+    return requests ? static_cast<double>(tier.hits) / requests : 0.0;
+}
+
+// Parse a --policy option value
+static bool parse_policy (const char* name, Iris::SlideCachePolicy& policy)
+{
+    if      (strcmp(name, "lru") == 0) policy = Iris::SLIDE_CACHE_POLICY_LRU;
+    else if (strcmp(name, "2q")  == 0) policy = Iris::SLIDE_CACHE_POLICY_2Q;
+    else if (strcmp(name, "arc") == 0) policy = Iris::SLIDE_CACHE_POLICY_ARC;
+    else return false;
+    return true;
+}
+
+int main (int argc, char** argv)
+{
+    // Options may appear anywhere; the remaining arguments
+    // are the recording and then the optional slide path.
+    // --policy and --budget override the recorded cache settings;
+    // a setting not given then takes its SlideOpenInfo default.
+    const char*             recording       = nullptr;
+    const char*             slide_path      = nullptr;
+    bool                    realtime        = false;
+    bool                    usage           = false;
+    bool                    override_cache  = false;
+    Iris::SlideCachePolicy  policy          = Iris::SLIDE_CACHE_POLICY_LRU;
+    size_t                  budget          = 0;
+    for (int arg = 1; arg < argc; ++arg) {
+        if (strcmp(argv[arg], "--realtime") == 0) realtime = true;
+        else if (strncmp(argv[arg], "--policy=", 9) == 0) {
+            override_cache = true;
+            if (!parse_policy(argv[arg] + 9, policy)) usage = true;
+        }
+        else if (strncmp(argv[arg], "--budget=", 9) == 0) {
+            override_cache = true;
+            budget = strtoull(argv[arg] + 9, nullptr, 10) * 1024 * 1024;
+            if (!budget) usage = true;
+        }
+        else if (strncmp(argv[arg], "--", 2) == 0) usage = true;
+        else if (!recording) recording = argv[arg];
+        else if (!slide_path) slide_path = argv[arg];
+        else usage = true;
+    }
+    if (usage || !recording) {
+        std::cerr << "Usage: " << argv[0] << " [--realtime] [--policy=lru|2q|arc] [--budget=<MiB>]"
+                  << " <recording> [slide file path]\n";
+        return EXIT_FAILURE;
+    }
+
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ //
+    //  Create and bind an offscreen Viewer     //
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ //
+    // See main.cpp for a description of these steps.
+    std::string bundle_path = std::filesystem::canonical("/proc/self/exe")
+                              .parent_path().string();
+    Iris::Viewer viewer = Iris::create_viewer(Iris::ViewerCreateInfo {
+        .ApplicationName         = "Iris Replay",
+        .ApplicationVersion      = 20240101,
+        .ApplicationBundlePath   = bundle_path.c_str(),
+    });
+    if (!viewer) return EXIT_FAILURE;
+    Iris::Result result = Iris::viewer_bind_external_surface(Iris::ViewerBindExternalSurfaceInfo {
+        .viewer      = viewer,
+        .width       = FRAME_WIDTH,
+        .height      = FRAME_HEIGHT,
+        .preferCPU   = true,
+    });
+    if (result != Iris::IRIS_SUCCESS) {
+        std::cerr << "Failed to bind offscreen surface: " << result.message << "\n";
+        return EXIT_FAILURE;
+    }
+
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ //
+    //         Replay the recorded session      //
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ //
+    // Stepping one recorded call per frame (realtime = false) is
+    // deterministic and best for comparing runs. Realtime replay
+    // reproduces the user's schedule for latency measurements.
+    Iris::ViewerReplayReport report;
+    result = Iris::viewer_replay_recording(Iris::ViewerReplayInfo {
+        .viewer         = viewer,
+        .recordingPath  = recording,
+        .slidePath      = slide_path,
+        .realtime       = realtime,
+        .overrideCache  = override_cache,
+        .capacityBytes  = budget,
+        .cachePolicy    = policy,
+    }, report);
+    if (result != Iris::IRIS_SUCCESS) {
+        std::cerr << "Failed to replay session: " << result.message << "\n";
+        return EXIT_FAILURE;
+    }
+
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ //
+    //            Report the session            //
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ //
+    std::cout
+    << "frames:              " << report.frames                           << "\n"
+    << "latency p50 (ms):    " << report.latencyP50                       << "\n"
+    << "latency p90 (ms):    " << report.latencyP90                       << "\n"
+    << "latency p99 (ms):    " << report.latencyP99                       << "\n"
+    << "latency max (ms):    " << report.latencyMax                       << "\n"
+    << "tiles missed:        " << report.tilesMissed                      << "\n"
+    << "frames with misses:  " << report.framesMissed                     << "\n"
+    << "decoded hit rate:    " << hit_rate(report.cache.decoded)          << "\n"
+    << "compressed hit rate: " << hit_rate(report.cache.compressed)       << "\n";
+
+    Iris::viewer_unbind_surface(viewer);
+    return EXIT_SUCCESS;
+}
@@ -258,12 +258,13 @@ HRESULT open_slide_file(HWND hWnd, Iris::Viewer& viewer)
 // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ //
 // Build required methods and structures to track user interactions
 // 
-// Get the current time in milliseconds since the epoch
-long get_millisec_timestamp()
+// Get the current time in microseconds since the epoch
+// (64-bit, as a long is only 32 bits on Windows)
+int64_t get_current_microsecond_timestamp()
 {
-    auto ms_since_epoch = std::chrono::duration_cast<std::chrono::microseconds>
+    auto us_since_epoch = std::chrono::duration_cast<std::chrono::microseconds>
         (std::chrono::system_clock::now().time_since_epoch());
-    return ms_since_epoch.count();
+    return us_since_epoch.count();
 }
 // Create an input tracker to track the location of the cursor over time
 // We will keep it in global scope for now but this could be added to the hWnd
@@ -273,7 +274,7 @@ struct InputTracker {
     float   y;
     float   x_vel;
     float   y_vel;
-    long    timestamp;
+    int64_t timestamp;
 } tracker;
 
 //  FUNCTION: WndProc(HWND, UINT, WPARAM, LPARAM)
@@ -333,6 +334,17 @@ LRESULT CALLBACK WndProc(HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam)
         case 0x43 /*this is the 'C' key for 'close'*/:
             open_slide_file (hWnd, viewer);
             break;
+        // Toggle recording of the session (the translate and zoom calls below)
+        // so it can be replayed headless and measured (see Linux/replay.cpp).
+        case 0x52 /*this is the 'R' key for 'record'*/: {
+            static bool recording = false;
+            if (recording) {
+                Iris::viewer_end_recording(viewer);
+                recording = false;
+            }
+            // Only consider the session recording if it actually began
+            else recording = Iris::viewer_begin_recording(viewer, "session.irec") == Iris::IRIS_SUCCESS;
+        } break;
         // If UP arrow key pressed, move the scope view an entire screen height up.
         case VK_UP:
             Iris::viewer_engine_translate(viewer, Iris::ViewerTranslateScope{
@@ -394,7 +406,7 @@ LRESULT CALLBACK WndProc(HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam)
         tracker.x_vel = 0;
         tracker.y_vel = 0;
         // Save the time this happened; it is used for calculating velocity
-        tracker.timestamp = get_millisec_timestamp();
+        tracker.timestamp = get_current_microsecond_timestamp();
     } break;
     case WM_MOUSEMOVE: {
         // If the left mouse button is being held down, the view is being dragged.
@@ -409,23 +421,25 @@ LRESULT CALLBACK WndProc(HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam)
             // And set the tracker to this location
             float x = static_cast<float>(pts.x) / width;
             float y = static_cast<float>(pts.y) / height;
-            long dt = get_millisec_timestamp() - tracker.timestamp;
+            int64_t dt = get_current_microsecond_timestamp() - tracker.timestamp;
             // Calculate the update. It gets the current locations, the current time, and velocities
+            // Velocities are in viewspace fractions per second and
+            // carry the same sign as the translations submitted below.
             InputTracker update{
                 .x = x,
                 .y = y,
-                .x_vel = (x - tracker.x) / static_cast<float>(dt / 1E7) / 2.f,
-                .y_vel = (y - tracker.y) / static_cast<float>(dt / 1E7) / 2.f,
-                .timestamp = get_millisec_timestamp(),
+                .x_vel = (x - tracker.x) / static_cast<float>(dt / 1E6),
+                .y_vel = (y - tracker.y) / static_cast<float>(dt / 1E6),
+                .timestamp = get_current_microsecond_timestamp(),
             };
             // Calculate the distance dragged during this event duration
             Iris::viewer_engine_translate(viewer, Iris::ViewerTranslateScope{
                 // This x-translation calculation may seem confusing. An easy alternative is 
                 // .x_translate = (update.x - tracker.x), which will track cursor movement 1:1
                 // What is here is a personal preference that moves above 1:1 scaled with velocity
-                //                  1:1 normal          Times 1 + velocity^1.1 then scaled back by 5 to keep the effect under control
-                .x_translate = (update.x - tracker.x) * (std::pow(std::abs(update.x_vel), 4f) / 10.f + 1.f),
-                .y_translate = (update.y - tracker.y) * (std::pow(std::abs(update.y_vel), 4f) / 10.f + 1.f),
+                //                  1:1 normal          Times 1 + (velocity * 5)^4 then scaled back by 10 to keep the effect under control
+                .x_translate = (update.x - tracker.x) * (std::pow(std::abs(update.x_vel) * 5.f, 4.f) / 10.f + 1.f),
+                .y_translate = (update.y - tracker.y) * (std::pow(std::abs(update.y_vel) * 5.f, 4.f) / 10.f + 1.f),
                 .x_velocity = update.x_vel,
                 .y_velocity = update.y_vel
                 });
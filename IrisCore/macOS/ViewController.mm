@@ -27,6 +27,7 @@
 // and debugging output (iostream)
 #import "IrisCore.hpp"
 #import <chrono>
+#import <algorithm>
 #import <iostream>
 
 // NOTE: iOS has more advanced UI capabilities with the 
@@ -262,16 +263,19 @@ struct TouchTracker {
     t -= _tracker.timestamp;
 
     // Define the update (where we are now).
+    // Velocities are smoothed, in viewspace fractions per second, and
+    // carry the same sign as the translations submitted below.
     TouchTracker update = {
         .x          = x,
         .y          = y,
         .timestamp  = t,
-        .x_vel      = (_tracker.x_vel + (_tracker.x - x) / static_cast<float>(t / 1E7))/2.f,
-        .y_vel      = (_tracker.y_vel + (_tracker.y - y) / static_cast<float>(t / 1E7))/2.f,
+        .x_vel      = (_tracker.x_vel + (x - _tracker.x) / static_cast<float>(t / 1E6))/2.f,
+        .y_vel      = (_tracker.y_vel + (_tracker.y - y) / static_cast<float>(t / 1E6))/2.f,
     };
-    // If the velocity was really high, set a max of 2.0f
-    if (abs(update.x_vel) > 2.f) update.x_vel = 2.f;
-    if (abs(update.y_vel) > 2.f) update.y_vel = 2.f;
+    // If the velocity was really high (a sampling spike), limit it
+    // to 10 screens per second in either direction.
+    update.x_vel = std::clamp(update.x_vel, -10.f, 10.f);
+    update.y_vel = std::clamp(update.y_vel, -10.f, 10.f);
     
     // We have decided to have 2-finger touch events
     // be the events that translate the scope view.
@@ -302,9 +306,11 @@ struct TouchTracker {
         // scope view translation. The translation amount increases exponentially
         // with respect to the velocity of the finger movement. This makes movement 
         // 'feel' easier. All factors are arbitray / empiric based on trial and error.
+        float x_gain = std::min(std::abs(update.x_vel) * 10.f, 2.f);
+        float y_gain = std::min(std::abs(update.y_vel) * 10.f, 2.f);
         Iris::viewer_engine_translate(self.handle, Iris::ViewerTranslateScope {
-            .x_translate = -(_tracker.x - x) * (std::pow(abs(update.x_vel), 2.f)/1.5f+2.f),
-            .y_translate =  (_tracker.y - y) * (std::pow(abs(update.y_vel), 2.f)/1.5f+2.f),
+            .x_translate = -(_tracker.x - x) * (std::pow(x_gain, 2.f)/1.5f+2.f),
+            .y_translate =  (_tracker.y - y) * (std::pow(y_gain, 2.f)/1.5f+2.f),
             .x_velocity  = update.x_vel,
             .y_velocity  = update.y_vel,
             